@@ -140,8 +140,7 @@ NAMESPACE_BEGIN(nanobind)
  *         Py_INCREF(o);
  *     },
  *     [](PyObject *o) noexcept {
- *         nb::gil_scoped_acquire guard;
- *         Py_DECREF(o);
+ *         nb::dec_ref_deferred(o);
  *     });
  * ```
  *
@@ -25,6 +25,24 @@ struct iterator_state {
     bool first_or_done;
 };
 
+template <typename Chunk, typename Access, rv_policy Policy,
+          typename Iterator, typename Sentinel, typename ValueType>
+struct chunk_iterator_state {
+    Iterator it;
+    Sentinel end;
+    size_t chunk_size;
+};
+
+/// Can the number of remaining elements be computed via 'end - it'?
+template <typename T>
+using iterator_distance_test =
+    decltype((size_t) (std::declval<typename T::second_type &>() -
+                       std::declval<typename T::first_type &>()));
+
+template <typename Iterator, typename Sentinel>
+constexpr bool has_iterator_distance_v =
+    is_detected_v<iterator_distance_test, std::pair<Iterator, Sentinel>>;
+
 // Note: these helpers take the iterator by non-const reference because some
 // iterators in the wild can't be dereferenced when const.
 template <typename Iterator> struct iterator_access {
@@ -42,6 +60,102 @@ template <typename Iterator> struct iterator_value_access {
     result_type operator()(Iterator &it) const { return (*it).second; }
 };
 
+/// Native tp_iternext slot: no method lookup, no function dispatch, and
+/// iteration ends by returning NULL instead of raising StopIteration
+template <typename State, typename Access, rv_policy Policy, typename ValueType>
+PyObject *iterator_next(PyObject *self) noexcept {
+    State &s = *inst_ptr<State>(self);
+
+    try {
+        if (!s.first_or_done)
+            ++s.it;
+        else
+            s.first_or_done = false;
+
+        if (s.it == s.end) {
+            s.first_or_done = true;
+            return nullptr;
+        }
+
+        cleanup_list cleanup(self);
+        PyObject *result =
+            make_caster<ValueType>::from_cpp(Access()(s.it), Policy, &cleanup)
+                .ptr();
+
+        if (NB_UNLIKELY(cleanup.used()))
+            cleanup.release();
+
+        if (NB_UNLIKELY(!result && !PyErr_Occurred()))
+            PyErr_SetString(PyExc_TypeError,
+                            "Unable to convert the iterator value to a Python "
+                            "type!");
+
+        return result;
+    } catch (...) {
+        nb_func_set_error();
+        return nullptr;
+    }
+}
+
+/// Native tp_iternext slot of iterators created by make_chunk_iterator()
+template <typename State, typename Chunk, typename Access, rv_policy Policy,
+          typename ValueType>
+PyObject *chunk_iterator_next(PyObject *self) noexcept {
+    State &s = *inst_ptr<State>(self);
+
+    if (s.it == s.end)
+        return nullptr;
+
+    cleanup_list cleanup(self);
+    PyObject *result = nullptr;
+
+    try {
+        if constexpr (std::is_same_v<Chunk, list>) {
+            list chunk;
+            for (size_t i = 0; i < s.chunk_size && s.it != s.end; ++i, ++s.it) {
+                handle h = make_caster<ValueType>::from_cpp(Access()(s.it),
+                                                            Policy, &cleanup);
+                if (!h.is_valid()) {
+                    if (!PyErr_Occurred())
+                        PyErr_SetString(PyExc_TypeError,
+                                        "Unable to convert the iterator value "
+                                        "to a Python type!");
+                    raise_python_error();
+                }
+                chunk.append(steal(h));
+            }
+            result = chunk.release().ptr();
+        } else {
+            using Scalar = typename Chunk::Scalar;
+            static_assert(std::is_arithmetic_v<Scalar> &&
+                              std::is_arithmetic_v<std::decay_t<ValueType>>,
+                          "make_chunk_iterator(): ndarray chunks require an "
+                          "arithmetic element type!");
+
+            size_t n = 0, shape[1] = { s.chunk_size };
+            Chunk chunk = Chunk::empty(1, shape);
+            Scalar *out = chunk.data();
+            for (; n < s.chunk_size && s.it != s.end; ++n, ++s.it)
+                out[n] = (Scalar) Access()(s.it);
+
+            // Zero-copy view of the filled part of the final chunk
+            if (n < s.chunk_size)
+                chunk = Chunk(chunk.slice(0, 0, (int64_t) n));
+
+            result = make_caster<Chunk>::from_cpp(chunk, rv_policy::automatic,
+                                                  &cleanup).ptr();
+        }
+    } catch (...) {
+        nb_func_set_error();
+        result = nullptr;
+    }
+
+    if (NB_UNLIKELY(cleanup.used()))
+        cleanup.release();
+
+    return result;
+}
+
 template <typename Access, rv_policy Policy, typename Iterator,
           typename Sentinel, typename ValueType, typename... Extra>
 iterator make_iterator_impl(handle scope, const char *name,
@@ -50,30 +164,95 @@ iterator make_iterator_impl(handle scope, const char *name,
     using State = iterator_state<Access, Policy, Iterator, Sentinel, ValueType, Extra...>;
 
     if (!type<State>().is_valid()) {
-        class_<State>(scope, name)
-            .def("__iter__", [](handle h) { return h; })
-            .def("__next__",
-                 [](State &s) -> ValueType {
-                     if (!s.first_or_done)
-                         ++s.it;
-                     else
-                         s.first_or_done = false;
-
-                     if (s.it == s.end) {
-                         s.first_or_done = true;
-                         throw stop_iteration();
-                     }
-
-                     return Access()(s.it);
-                 },
-                 std::forward<Extra>(extra)...,
-                 Policy);
+        auto cl = [&] {
+            if constexpr (sizeof...(Extra) == 0) {
+                static const PyType_Slot slots[] = {
+                    { Py_tp_iter, (void *) PyObject_SelfIter },
+                    { Py_tp_iternext,
+                      (void *) iterator_next<State, Access, Policy, ValueType> },
+                    { 0, nullptr }
+                };
+
+                return class_<State>(scope, name, type_slots(slots));
+            } else {
+                return class_<State>(scope, name);
+            }
+        }();
+
+        if constexpr (sizeof...(Extra) != 0) {
+            // Function annotations (e.g. nb::keep_alive) require the regular
+            // function dispatch mechanism
+            cl.def("__iter__", [](handle h) { return h; })
+              .def("__next__",
+                   [](State &s) -> ValueType {
+                       if (!s.first_or_done)
+                           ++s.it;
+                       else
+                           s.first_or_done = false;
+
+                       if (s.it == s.end) {
+                           s.first_or_done = true;
+                           throw stop_iteration();
+                       }
+
+                       return Access()(s.it);
+                   },
+                   std::forward<Extra>(extra)...,
+                   Policy);
+        }
+
+        if constexpr (has_iterator_distance_v<Iterator, Sentinel>) {
+            // Lets list(), tuple(), etc. preallocate their storage
+            cl.def("__length_hint__", [](State &s) -> size_t {
+                if (s.it == s.end)
+                    return 0;
+                size_t n = (size_t) (s.end - s.it);
+                return s.first_or_done ? n : n - 1;
+            });
+        }
     }
 
     return borrow<iterator>(cast(State{ std::forward<Iterator>(first),
                                         std::forward<Sentinel>(last), true }));
 }
 
+template <typename Chunk, typename Access, rv_policy Policy,
+          typename Iterator, typename Sentinel, typename ValueType>
+iterator make_chunk_iterator_impl(handle scope, const char *name,
+                                  Iterator &&first, Sentinel &&last,
+                                  size_t chunk_size) {
+    using State = chunk_iterator_state<Chunk, Access, Policy, Iterator,
+                                       Sentinel, ValueType>;
+
+    if (chunk_size == 0)
+        throw value_error("make_chunk_iterator(): chunk size must be positive!");
+
+    if (!type<State>().is_valid()) {
+        static const PyType_Slot slots[] = {
+            { Py_tp_iter, (void *) PyObject_SelfIter },
+            { Py_tp_iternext,
+              (void *) chunk_iterator_next<State, Chunk, Access, Policy,
+                                           ValueType> },
+            { 0, nullptr }
+        };
+
+        class_<State> cl(scope, name, type_slots(slots));
+
+        if constexpr (has_iterator_distance_v<Iterator, Sentinel>) {
+            cl.def("__length_hint__", [](State &s) -> size_t {
+                if (s.it == s.end)
+                    return 0;
+                return ((size_t) (s.end - s.it) + s.chunk_size - 1) /
+                       s.chunk_size;
+            });
+        }
+    }
+
+    return borrow<iterator>(cast(State{ std::forward<Iterator>(first),
+                                        std::forward<Sentinel>(last),
+                                        chunk_size }));
+}
+
 NAMESPACE_END(detail)
 
 /// Makes a python iterator from a first and past-the-end C++ InputIterator.
@@ -130,4 +309,30 @@ iterator make_iterator(handle scope, const char *name, Type &value, Extra &&...e
                                  std::forward<Extra>(extra)...);
 }
 
+/// Makes a python iterator that yields chunks of up to `chunk_size` elements
+/// from a first and past-the-end C++ InputIterator. Chunks are Python lists
+/// by default, or 1D arrays when `Chunk` is a nb::ndarray<..> type.
+template <typename Chunk = list,
+          rv_policy Policy = rv_policy::reference_internal,
+          typename Iterator,
+          typename Sentinel,
+          typename ValueType = typename detail::iterator_access<Iterator>::result_type>
+iterator make_chunk_iterator(handle scope, const char *name, Iterator &&first,
+                             Sentinel &&last, size_t chunk_size) {
+    return detail::make_chunk_iterator_impl<
+        Chunk, detail::iterator_access<Iterator>, Policy, Iterator, Sentinel,
+        ValueType>(scope, name, std::forward<Iterator>(first),
+                   std::forward<Sentinel>(last), chunk_size);
+}
+
+/// Makes a chunked iterator over values of a container supporting `std::begin()`/`std::end()`
+template <typename Chunk = list,
+          rv_policy Policy = rv_policy::reference_internal,
+          typename Type>
+iterator make_chunk_iterator(handle scope, const char *name, Type &value,
+                             size_t chunk_size) {
+    return make_chunk_iterator<Chunk, Policy>(scope, name, std::begin(value),
+                                              std::end(value), chunk_size);
+}
+
 NAMESPACE_END(NB_NAMESPACE)
@@ -50,11 +50,14 @@ template <typename... Ts> struct call_guard {
 struct dynamic_attr {};
 struct is_method {};
 struct is_implicit {};
+struct direct {};
 struct is_operator {};
 struct is_arithmetic {};
+struct is_flag {};
 struct is_final {};
 
 template <size_t /* Nurse */, size_t /* Patient */> struct keep_alive {};
+template <typename... /* ndarray annotations */> struct ret_array {};
 template <typename T> struct supplement {};
 template <typename T> struct intrusive_ptr {
     intrusive_ptr(void (*set_self_py)(T *, PyObject *) noexcept)
@@ -117,7 +120,9 @@ enum class func_flags : uint32_t {
     /// Does this overload specify a raw docstring that should take precedence?
     raw_doc = (1 << 16),
     /// Does this function have one or more nb::keep_alive() annotations?
-    has_keep_alive = (1 << 17)
+    has_keep_alive = (1 << 17),
+    /// Was the function annotated with nb::direct()? (see func_data_prelim::direct)
+    has_direct = (1 << 18)
 };
 
 struct arg_data {
@@ -151,6 +156,10 @@ template <size_t Size> struct func_data_prelim {
     /// Total number of function call arguments
     uint32_t nargs;
 
+    /// C++ signature and type-erased entry point for direct calls from C++
+    const std::type_info *direct_type;
+    void (*direct)();
+
     // ------- Extra fields -------
 
     const char *name;
@@ -232,6 +241,12 @@ NB_INLINE void func_extra_apply(F &f, const arg_v &a, size_t &index) {
 template <typename F, typename... Ts>
 NB_INLINE void func_extra_apply(F &, call_guard<Ts...>, size_t &) {}
 
+template <typename F, typename... As>
+NB_INLINE void func_extra_apply(F &, nanobind::ret_array<As...>, size_t &) {}
+
+template <typename F>
+NB_INLINE void func_extra_apply(F &, nanobind::direct, size_t &) {}
+
 template <typename F, size_t Nurse, size_t Patient>
 NB_INLINE void func_extra_apply(F &f, nanobind::keep_alive<Nurse, Patient>, size_t &) {
     f.flags |= (uint32_t) func_flags::has_keep_alive;
@@ -239,7 +254,9 @@ NB_INLINE void func_extra_apply(F &f, nanobind::keep_alive<Nurse, Patient>, size
 
 template <typename... Ts> struct func_extra_info {
     using call_guard = void;
+    using ret_array = void;
     static constexpr bool keep_alive = false;
+    static constexpr bool direct = false;
 };
 
 template <typename T, typename... Ts> struct func_extra_info<T, Ts...>
@@ -257,6 +274,19 @@ struct func_extra_info<nanobind::keep_alive<Nurse, Patient>, Ts...> : func_extra
     static constexpr bool keep_alive = true;
 };
 
+template <typename... As, typename... Ts>
+struct func_extra_info<nanobind::ret_array<As...>, Ts...> : func_extra_info<Ts...> {
+    using ret_array = nanobind::ret_array<As...>;
+};
+
+template <typename... Ts>
+struct func_extra_info<nanobind::direct, Ts...> : func_extra_info<Ts...> {
+    static constexpr bool direct = true;
+};
+
+/// Return value type caster used by nb::ret_array<..> (defined in ndarray.h)
+template <typename T, typename RetArray> struct ret_array_caster;
+
 template <typename T>
 NB_INLINE void process_keep_alive(PyObject **, PyObject *, T *) { }
 
@@ -277,6 +277,30 @@ template <typename T, typename X> struct type_caster<typed<T, X>> {
     }
 };
 
+template <typename Container> struct type_caster<owned_buffer<Container>> {
+    using Value = owned_buffer<Container>;
+    using Entry = typename Container::value_type;
+    static constexpr auto Name = const_name("memoryview");
+
+    static_assert(std::is_trivially_copyable_v<Entry>,
+                  "nb::owned_buffer<T>: T must store trivially copyable entries!");
+
+    static handle from_cpp(Value &&src, rv_policy, cleanup_list *) noexcept {
+        bool writable = src.writable();
+
+        Container *c = new (std::nothrow) Container(std::move(src.value()));
+        if (!c) {
+            PyErr_NoMemory();
+            return handle();
+        }
+
+        // Query the storage after the move (short strings are stored inline)
+        return buffer_new((void *) c->data(), c->size() * sizeof(Entry),
+                          !writable, c,
+                          [](void *p) noexcept { delete (Container *) p; });
+    }
+};
+
 template <typename T>
 struct type_caster<T, enable_if_t<std::is_base_of_v<detail::api_tag, T>>> {
 public:
@@ -49,7 +49,10 @@ enum class type_flags : uint32_t {
     /// If so, type_data::keep_shared_from_this_alive is also set.
     has_shared_from_this     = (1 << 12),
 
-    // Six more flag bits available (13 through 18) without needing
+    /// Is this an enumeration created via nb::enum_<..>?
+    is_enum                  = (1 << 13),
+
+    // Five more flag bits available (14 through 18) without needing
     // a larger reorganization
 };
 
@@ -77,6 +80,8 @@ enum class type_init_flags : uint32_t {
     all_init_flags           = (0x1f << 19)
 };
 
+struct override_table;
+
 /// Information about a type that persists throughout its lifetime
 struct type_data {
     uint32_t size;
@@ -92,6 +97,7 @@ struct type_data {
     bool (**implicit_py)(PyTypeObject *, PyObject *, cleanup_list *) noexcept;
     void (*set_self_py)(void *, PyObject *) noexcept;
     bool (*keep_shared_from_this_alive)(PyObject *) noexcept;
+    override_table *overrides;
 #if defined(Py_LIMITED_API)
     size_t dictoffset;
 #endif
@@ -158,23 +164,36 @@ NB_INLINE void type_extra_apply(type_init_data &t, supplement<T>) {
     t.supplement = sizeof(T);
 }
 
+struct enum_table;
+
 /// Information about an enum, stored as its type_data::supplement
 struct enum_supplement {
     bool is_signed = false;
+    bool is_arithmetic = false;
+    bool is_flag = false;
     PyObject* entries = nullptr;
     PyObject* scope = nullptr;
+    /// Cached unnamed values of flag enums (created on demand, bounded)
+    PyObject* composites = nullptr;
+    /// Entries indexed by value (built on demand from 'entries' and 'composites')
+    enum_table* table = nullptr;
 };
 
 /// Information needed to create an enum
 struct enum_init_data : type_init_data {
     bool is_signed = false;
     bool is_arithmetic = false;
+    bool is_flag = false;
 };
 
 NB_INLINE void type_extra_apply(enum_init_data &ed, is_arithmetic) {
     ed.is_arithmetic = true;
 }
 
+NB_INLINE void type_extra_apply(enum_init_data &ed, is_flag) {
+    ed.is_flag = true;
+}
+
 // Enums can't have base classes or supplements or be intrusive, and
 // are always final. They can't use type_slots_callback because that is
 // used by the enum mechanism internally, but can provide additional
@@ -597,7 +616,8 @@ public:
                    (uint32_t) detail::type_flags::is_copy_constructible |
                    (uint32_t) detail::type_flags::is_move_constructible |
                    (uint32_t) detail::type_flags::is_destructible |
-                   (uint32_t) detail::type_flags::is_final);
+                   (uint32_t) detail::type_flags::is_final |
+                   (uint32_t) detail::type_flags::is_enum);
         d.align = (uint8_t) alignof(T);
         d.size = (uint32_t) sizeof(T);
         d.name = name;
@@ -614,6 +634,8 @@ public:
 
         detail::enum_supplement &supp = type_supplement<detail::enum_supplement>(*this);
         supp.is_signed = d.is_signed;
+        supp.is_arithmetic = d.is_arithmetic;
+        supp.is_flag = d.is_flag;
         supp.scope = d.scope;
     }
 
@@ -56,6 +56,13 @@ template <size_t... Digits> struct int_to_str<0, Digits...> {
 
 constexpr auto const_name(char c) { return descr<1>(c); }
 
+/// Name that differs between function arguments ('text1') and return values ('text2')
+template <size_t N1, size_t N2>
+constexpr auto io_name(char const (&text1)[N1], char const (&text2)[N2]) {
+    return const_name('@') + const_name(text1) + const_name('@') +
+           const_name(text2) + const_name('@');
+}
+
 // Ternary description (like std::conditional)
 template <bool B, size_t N1, size_t N2>
 constexpr auto const_name(char const(&text1)[N1], char const(&text2)[N2]) {
@@ -26,6 +26,14 @@ bool from_python_keep_alive(Caster &c, PyObject **args, uint8_t *args_flags,
     return true;
 }
 
+/// Does 'T' wrap a Python object? (specialized for nb::ndarray<..> in ndarray.h)
+template <typename T> struct is_python_object
+    : std::bool_constant<std::is_base_of_v<api_tag, T> ||
+                         std::is_same_v<T, PyObject>> { };
+
+template <typename T>
+constexpr bool is_python_object_v = is_python_object<intrinsic_t<T>>::value;
+
 template <bool ReturnRef, bool CheckGuard, typename Func, typename Return,
           typename... Args, size_t... Is, typename... Extra>
 NB_INLINE PyObject *func_create(Func &&func, Return (*)(Args...),
@@ -72,8 +80,10 @@ NB_INLINE PyObject *func_create(Func &&func, Return (*)(Args...),
         "nb::args must follow positional arguments and precede nb::kwargs!");
 
     // Collect function signature information for the docstring
-    using cast_out = make_caster<
-        std::conditional_t<std::is_void_v<Return>, void_type, Return>>;
+    using cast_out = std::conditional_t<
+        std::is_void_v<typename Info::ret_array>,
+        make_caster<std::conditional_t<std::is_void_v<Return>, void_type, Return>>,
+        ret_array_caster<Return, typename Info::ret_array>>;
 
     // Compile-time function signature
     static constexpr auto descr =
@@ -161,6 +171,36 @@ NB_INLINE PyObject *func_create(Func &&func, Return (*)(Args...),
         return result;
     };
 
+    /* Functions annotated with nb::direct() are invoked directly (without the
+       GIL) when passed to a std::function<..> argument */
+    if constexpr (Info::direct) {
+        static_assert(!is_method_det && !Info::keep_alive &&
+                      std::is_void_v<typename Info::call_guard> &&
+                      std::is_void_v<typename Info::ret_array> &&
+                      args_pos_1 == nargs && kwargs_pos_1 == nargs,
+                      "nb::direct() requires a function without nb::is_method, "
+                      "nb::keep_alive, nb::call_guard, nb::ret_array, nb::args, "
+                      "or nb::kwargs annotations!");
+        static_assert(!is_python_object_v<Return> &&
+                      !(is_python_object_v<Args> || ...),
+                      "nb::direct(): the arguments and return value of the "
+                      "function cannot be Python objects, since they would "
+                      "be copied without holding the GIL!");
+
+        f.flags |= (uint32_t) func_flags::has_direct;
+        f.direct_type = &typeid(Return (*)(Args...));
+        f.direct = (void (*)()) (Return (*)(void *, Args...))
+            [](void *p, Args... args) -> Return {
+                const capture *cap;
+                if constexpr (sizeof(capture) <= sizeof(f.capture))
+                    cap = (capture *) p;
+                else
+                    cap = (capture *) ((void **) p)[0];
+
+                return cap->func((forward_t<Args>) args...);
+            };
+    }
+
     f.descr = descr.text;
     f.descr_types = descr_types;
     f.nargs = nargs;
@@ -120,6 +120,10 @@ NB_CORE PyObject *str_from_cstr(const char *c);
 /// Convert an UTF8 C string + size into a Python unicode string
 NB_CORE PyObject *str_from_cstr_and_size(const char *c, size_t n);
 
+/// Like the above, but consults the string interning cache. Returns nullptr
+/// and sets a Python error when 'c' is not valid UTF-8
+NB_CORE PyObject *str_from_utf8(const char *c, size_t n) noexcept;
+
 // ========================================================================
 
 /// Convert a Python object into a Python byte string
@@ -147,6 +151,9 @@ NB_CORE PyObject *list_from_obj(PyObject *o);
 /// Convert a Python object into a Python tuple
 NB_CORE PyObject *tuple_from_obj(PyObject *o);
 
+/// Create an empty dictionary with space for 'size' entries, if supported
+NB_CORE PyObject *dict_new_presized(size_t size) noexcept;
+
 // ========================================================================
 
 /// Get an object attribute or raise an exception
@@ -212,6 +219,17 @@ NB_CORE PyObject *obj_vectorcall(PyObject *base, PyObject *const *args,
                                  size_t nargsf, PyObject *kwnames,
                                  bool method_call);
 
+/// Return the vectorcall entry point of 'o', if available
+NB_CORE void *obj_vectorcall_get(PyObject *o) noexcept;
+
+/**
+ * Call 'o' with the positional arguments 'args[1..nargs]' (stealing them)
+ * via a vectorcall entry point previously obtained from obj_vectorcall_get().
+ * The caller must hold the GIL. 'args[0]' is scratch space for the callee.
+ */
+NB_CORE PyObject *obj_vectorcall_cached(PyObject *o, void *vectorcall,
+                                        PyObject **args, size_t nargs);
+
 /// Create an iterator from 'o', raise an exception in case of errors
 NB_CORE PyObject *obj_iter(PyObject *o);
 
@@ -259,6 +277,17 @@ NB_CORE PyObject *capsule_new(const void *ptr, const char *name,
 /// Create a Python function object for the given function record
 NB_CORE PyObject *nb_func_new(const void *data) noexcept;
 
+/// Convert the active C++ exception into a Python error (within 'catch (...)')
+NB_CORE void nb_func_set_error() noexcept;
+
+/**
+ * If 'o' is a bound function with a single overload whose C++ signature
+ * matches 'type', return its direct entry point and the offset of the
+ * captured callable relative to 'o'
+ */
+NB_CORE bool nb_func_get_direct(PyObject *o, const std::type_info *type,
+                                void (**direct)(), size_t *offset) noexcept;
+
 // ========================================================================
 
 /// Create a Python type object for the given type record
@@ -324,6 +353,13 @@ NB_CORE bool nb_type_isinstance(PyObject *obj, const std::type_info *t) noexcept
 /// Search for the Python type object associated with a C++ type
 NB_CORE PyObject *nb_type_lookup(const std::type_info *t) noexcept;
 
+/// Counter that changes whenever a type is destroyed or gains implicit conversions
+NB_CORE size_t nb_type_epoch() noexcept;
+
+/// Does the C++ type 't' reject all instances of 'tp' regardless of their value?
+NB_CORE bool nb_type_rejects(const std::type_info *t, PyTypeObject *tp,
+                             bool convert) noexcept;
+
 /// Allocate an instance of type 't'
 NB_CORE PyObject *nb_inst_alloc(PyTypeObject *t);
 
@@ -364,6 +400,12 @@ NB_CORE void nb_inst_set_state(PyObject *o, bool ready, bool destruct) noexcept;
 /// Query the 'ready' and 'destruct' flags of an instance
 NB_CORE std::pair<bool, bool> nb_inst_state(PyObject *o) noexcept;
 
+/// Number of active buffer protocol exports of an instance
+NB_CORE uint32_t nb_inst_exports(PyObject *o) noexcept;
+
+/// Adjust the above count by 'delta' (+1 or -1), returns 'false' on overflow
+NB_CORE bool nb_inst_add_exports(PyObject *o, int delta) noexcept;
+
 // ========================================================================
 
 // Create and install a Python property object
@@ -388,6 +430,10 @@ NB_CORE void keep_alive(PyObject *nurse, PyObject *patient);
 NB_CORE void keep_alive(PyObject *nurse, void *payload,
                         void (*deleter)(void *) noexcept) noexcept;
 
+// Return the payload that keep_alive() associated with 'nurse' and 'deleter'
+NB_CORE void *keep_alive_payload(PyObject *nurse,
+                                 void (*deleter)(void *) noexcept) noexcept;
+
 
 // ========================================================================
 
@@ -441,6 +487,29 @@ NB_CORE ndarray_handle *ndarray_create(void *value, size_t ndim,
                                        dlpack::dtype *dtype, bool ro,
                                        int32_t device, int32_t device_id);
 
+// Allocate pooled, aligned storage and describe it using a DLPack capsule
+NB_CORE ndarray_handle *ndarray_alloc(size_t ndim, const size_t *shape,
+                                      dlpack::dtype *dtype, char order,
+                                      bool zero, bool huge_pages, bool ro);
+
+// Map a region of a file into memory and describe it using a DLPack capsule
+NB_CORE ndarray_handle *ndarray_map_file(const char *filename, size_t ndim,
+                                         const size_t *shape,
+                                         dlpack::dtype *dtype, char order,
+                                         uint64_t offset, bool writable,
+                                         int advice);
+
+// Zero-copy views sharing the storage of an existing ndarray
+NB_CORE ndarray_handle *ndarray_slice(ndarray_handle *th, size_t axis,
+                                      int64_t start, int64_t stop,
+                                      int64_t step);
+NB_CORE ndarray_handle *ndarray_select(ndarray_handle *th, size_t axis,
+                                       int64_t index);
+NB_CORE ndarray_handle *ndarray_transpose(ndarray_handle *th, size_t ndim,
+                                          const size_t *axes);
+NB_CORE ndarray_handle *ndarray_reshape(ndarray_handle *th, size_t ndim,
+                                        const size_t *shape);
+
 /// Increase the reference count of the given ndarray object; returns a pointer
 /// to the underlying DLTensor
 NB_CORE dlpack::dltensor *ndarray_inc_ref(ndarray_handle *) noexcept;
@@ -455,6 +524,14 @@ NB_CORE PyObject *ndarray_wrap(ndarray_handle *, int framework,
 /// Check if an object is a known ndarray type (NumPy, PyTorch, Tensorflow, JAX)
 NB_CORE bool ndarray_check(PyObject *o) noexcept;
 
+/// Inner loop callback used by 'ndarray_iterate'
+using ndarray_iterate_cb = void (*)(void *payload, void **ptrs,
+                                    const int64_t *strides, size_t count);
+
+/// Broadcast several ndarrays against each other and call 'cb' for each inner loop
+NB_CORE void ndarray_iterate(size_t n, const dlpack::dltensor *tensors,
+                             ndarray_iterate_cb cb, void *payload);
+
 // ========================================================================
 
 /// Print to stdout using Python
@@ -483,6 +560,71 @@ NB_CORE bool load_u64(PyObject *o, uint8_t flags, uint64_t *out) noexcept;
 NB_CORE bool load_f32(PyObject *o, uint8_t flags, float *out) noexcept;
 NB_CORE bool load_f64(PyObject *o, uint8_t flags, double *out) noexcept;
 
+/// Callback that resizes a container to 'size' entries and returns its storage
+using load_seq_resize_cb = void *(*)(void *payload, size_t size);
+
+/**
+ * Bulk-load a sequence of numbers into contiguous storage provided by
+ * 'resize'. The target type is described by 'kind' ('i', 'u', or 'f') and
+ * 'size' (in bytes). Buffer objects (e.g., NumPy arrays, array.array) are
+ * copied or converted in one pass when implicit conversions are allowed.
+ */
+NB_CORE bool load_seq_arith(PyObject *o, uint8_t flags, char kind, size_t size,
+                            load_seq_resize_cb resize, void *payload) noexcept;
+
+/**
+ * Acquire a C-contiguous view of the memory of a bytes-like or buffer
+ * protocol object. The view is held by 'cleanup' and released along with
+ * it. Reports the size in bytes, the item size, and the kind of the
+ * elements ('i'/'u'/'f' for signed/unsigned/floating point scalars, or '\0'
+ * if the buffer format is not a native scalar type).
+ */
+NB_CORE bool buffer_get(PyObject *o, bool writable, cleanup_list *cleanup,
+                        void **data, size_t *size, size_t *itemsize,
+                        char *kind) noexcept;
+
+/**
+ * Create a 'memoryview' of 'size' bytes at 'data' without copying them. The
+ * memory is owned by 'payload', which is passed to 'deleter' once the view
+ * and all buffers derived from it have expired (or if this function fails).
+ */
+NB_CORE PyObject *buffer_new(void *data, size_t size, bool readonly,
+                             void *payload,
+                             void (*deleter)(void *) noexcept) noexcept;
+
+// ========================================================================
+
+/// Objects of the Python 'datetime' module used by nanobind/stl/chrono.h
+struct datetime_api {
+    /// Pointer to the 'PyDateTime_CAPI' table (nullptr on PyPy)
+    void *capi;
+
+    /// Types defined by the datetime module
+    PyObject *datetime, *date, *time, *timedelta;
+
+    /// Interned attribute names (used on Limited API builds and PyPy)
+    PyObject *days, *seconds, *microseconds, *year, *month, *day, *hour,
+        *minute, *second, *microsecond;
+};
+
+/// Import the 'datetime' module once per interpreter and return its objects
+NB_CORE const datetime_api *datetime_api_get();
+
+/// Callback receiving the entries of a 'datetime64' array in nanoseconds
+using load_datetime64_cb = void (*)(void *payload, const int64_t *data,
+                                    size_t size);
+
+/**
+ * Pass the entries of a one-dimensional NumPy 'datetime64' array to 'store'
+ * as nanoseconds since the epoch. Arrays with other time units are converted
+ * in bulk. Fails gracefully if 'o' is not such an array.
+ */
+NB_CORE bool load_datetime64(PyObject *o, load_datetime64_cb store,
+                             void *payload) noexcept;
+
+/// Create a NumPy 'datetime64[ns]' array with 'size' uninitialized entries
+NB_CORE PyObject *datetime64_new(size_t size, int64_t **data);
+
 // ========================================================================
 
 /// Increase the reference count of 'o', and check that the GIL is held
@@ -495,6 +637,7 @@ NB_CORE void decref_checked(PyObject *o) noexcept;
 
 NB_CORE void set_leak_warnings(bool value) noexcept;
 NB_CORE void set_implicit_cast_warnings(bool value) noexcept;
+NB_CORE void set_string_interning(size_t max_length, size_t capacity) noexcept;
 
 // ========================================================================
 
@@ -513,6 +656,10 @@ NB_CORE PyObject *repr_map(PyObject *o);
 
 NB_CORE bool is_alive() noexcept;
 
+/// Decrease the reference count of 'o', or queue this step when the calling
+/// thread does not hold the GIL
+NB_CORE void dec_ref_deferred(PyObject *o) noexcept;
+
 #if NB_TYPE_GET_SLOT_IMPL
 NB_CORE void *type_get_slot(PyTypeObject *t, int slot_id);
 #endif
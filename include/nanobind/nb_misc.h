@@ -39,6 +39,11 @@ inline void set_implicit_cast_warnings(bool value) noexcept {
     detail::set_implicit_cast_warnings(value);
 }
 
+inline void set_string_interning(size_t max_length,
+                                 size_t capacity = 4096) noexcept {
+    detail::set_string_interning(max_length, capacity);
+}
+
 inline dict globals() {
     PyObject *p = PyEval_GetGlobals();
     if (!p)
@@ -50,4 +55,8 @@ inline bool is_alive() noexcept {
     return detail::is_alive();
 }
 
+inline void dec_ref_deferred(handle h) noexcept {
+    detail::dec_ref_deferred(h.ptr());
+}
+
 NAMESPACE_END(NB_NAMESPACE)
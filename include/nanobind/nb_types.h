@@ -671,6 +671,24 @@ template <typename T> struct pointer_and_handle {
     handle h;
 };
 
+/**
+ * Return value wrapper that moves a contiguous container (e.g.,
+ * ``std::vector<uint8_t>`` or ``std::string``) into a Python object, which is
+ * exposed as a read-only or writable ``memoryview`` without copying the data.
+ */
+template <typename Container> class owned_buffer {
+public:
+    owned_buffer(Container &&value, bool writable = false)
+        : m_value(std::move(value)), m_writable(writable) { }
+
+    Container &value() { return m_value; }
+    bool writable() const { return m_writable; }
+
+private:
+    Container m_value;
+    bool m_writable;
+};
+
 NAMESPACE_BEGIN(detail)
 template <typename Derived> NB_INLINE api<Derived>::operator handle() const {
     return derived().ptr();
@@ -14,6 +14,9 @@
 
 #include <nanobind/nanobind.h>
 #include <initializer_list>
+#include <cstring>
+#include <vector>
+#include <array>
 
 NAMESPACE_BEGIN(NB_NAMESPACE)
 
@@ -70,14 +73,130 @@ NAMESPACE_BEGIN(detail)
 template <typename T>
 struct is_complex : public std::false_type { };
 
+inline uint32_t float_bits(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(float));
+    return u;
+}
+
+inline float float_from_bits(uint32_t u) {
+    float f;
+    memcpy(&f, &u, sizeof(float));
+    return f;
+}
+
+/// Convert a single precision value to IEEE 754 half precision (round to nearest even)
+inline uint16_t float_to_half(float f) {
+    uint32_t x = float_bits(f),
+             sign = (x >> 16) & 0x8000,
+             mant = x & 0x7fffff;
+    int32_t exp = (int32_t) ((x >> 23) & 0xff);
+
+    if (exp == 0xff) // Infinity or NaN
+        return (uint16_t) (sign | 0x7c00 | (mant ? (0x200 | (mant >> 13)) : 0));
+
+    exp += 15 - 127;
+    if (exp >= 0x1f) // Overflow
+        return (uint16_t) (sign | 0x7c00);
+
+    uint32_t h, rem, halfway;
+    if (exp <= 0) { // Subnormal result or underflow
+        if (exp < -10)
+            return (uint16_t) sign;
+        uint32_t shift = (uint32_t) (14 - exp);
+        mant |= 0x800000;
+        h = mant >> shift;
+        rem = mant & ((1u << shift) - 1);
+        halfway = 1u << (shift - 1);
+    } else {
+        h = ((uint32_t) exp << 10) | (mant >> 13);
+        rem = mant & 0x1fff;
+        halfway = 0x1000;
+    }
+
+    if (rem > halfway || (rem == halfway && (h & 1)))
+        h++; // May carry into the exponent, which is the correct behavior
+
+    return (uint16_t) (sign | h);
+}
+
+/// Convert an IEEE 754 half precision value to single precision
+inline float half_to_float(uint16_t h) {
+    uint32_t sign = ((uint32_t) h & 0x8000) << 16,
+             exp = ((uint32_t) h >> 10) & 0x1f,
+             mant = (uint32_t) h & 0x3ff;
+
+    if (exp == 0x1f) {
+        return float_from_bits(sign | 0x7f800000 | (mant << 13));
+    } else if (exp == 0) {
+        if (mant == 0)
+            return float_from_bits(sign);
+        exp = 127 - 14;
+        while (!(mant & 0x400)) {
+            mant <<= 1;
+            exp--;
+        }
+        mant &= 0x3ff;
+        return float_from_bits(sign | (exp << 23) | (mant << 13));
+    } else {
+        return float_from_bits(sign | ((exp + 127 - 15) << 23) | (mant << 13));
+    }
+}
+
+/// Convert a single precision value to bfloat16 (round to nearest even)
+inline uint16_t float_to_bfloat16(float f) {
+    uint32_t x = float_bits(f);
+    if ((x & 0x7fffffff) > 0x7f800000) // NaN: keep it quiet
+        return (uint16_t) ((x >> 16) | 0x40);
+    x += 0x7fff + ((x >> 16) & 1);
+    return (uint16_t) (x >> 16);
+}
+
+inline float bfloat16_to_float(uint16_t b) {
+    return float_from_bits((uint32_t) b << 16);
+}
+
 NAMESPACE_END(detail)
 
+/// IEEE 754 half precision floating point storage type
+struct half {
+    uint16_t value = 0;
+
+    half() = default;
+    half(float f) : value(detail::float_to_half(f)) { }
+    operator float() const { return detail::half_to_float(value); }
+
+    static half from_bits(uint16_t bits) {
+        half h;
+        h.value = bits;
+        return h;
+    }
+};
+
+/// Brain floating point storage type (upper 16 bits of an IEEE 754 float)
+struct bfloat16 {
+    uint16_t value = 0;
+
+    bfloat16() = default;
+    bfloat16(float f) : value(detail::float_to_bfloat16(f)) { }
+    operator float() const { return detail::bfloat16_to_float(value); }
+
+    static bfloat16 from_bits(uint16_t bits) {
+        bfloat16 b;
+        b.value = bits;
+        return b;
+    }
+};
+
 constexpr size_t any = (size_t) -1;
 
 template <size_t... Is> struct shape {
     static constexpr size_t size = sizeof...(Is);
 };
 
+/// Access pattern hints for memory-mapped arrays (see ndarray::map_file())
+enum class mmap_advice : int { normal, sequential, random, willneed };
+
 struct c_contig { };
 struct f_contig { };
 struct any_contig { };
@@ -95,8 +214,23 @@ template <typename T> struct ndarray_traits {
     static constexpr bool is_signed  = std::is_signed_v<T>;
 };
 
+template <> struct ndarray_traits<half> {
+    static constexpr bool is_complex = false;
+    static constexpr bool is_float   = true;
+    static constexpr bool is_bool    = false;
+    static constexpr bool is_int     = false;
+    static constexpr bool is_signed  = true;
+};
+
+template <> struct ndarray_traits<bfloat16> : ndarray_traits<half> { };
+template <> struct ndarray_traits<const half> : ndarray_traits<half> { };
+template <> struct ndarray_traits<const bfloat16> : ndarray_traits<half> { };
+
 NAMESPACE_BEGIN(detail)
 
+template <typename T>
+constexpr bool is_bfloat16_v = std::is_same_v<std::remove_cv_t<T>, bfloat16>;
+
 template <typename T>
 constexpr bool is_ndarray_scalar_v =
     ndarray_traits<T>::is_float || ndarray_traits<T>::is_int ||
@@ -119,7 +253,9 @@ template <typename T> constexpr dlpack::dtype dtype() {
 
     dlpack::dtype result;
 
-    if constexpr (ndarray_traits<T>::is_float)
+    if constexpr (detail::is_bfloat16_v<T>)
+        result.code = (uint8_t) dlpack::dtype_code::Bfloat;
+    else if constexpr (ndarray_traits<T>::is_float)
         result.code = (uint8_t) dlpack::dtype_code::Float;
     else if constexpr (ndarray_traits<T>::is_signed)
         result.code = (uint8_t) dlpack::dtype_code::Int;
@@ -136,6 +272,7 @@ template <typename T> constexpr dlpack::dtype dtype() {
     return result;
 }
 
+template <typename... Args> class ndarray;
 
 NAMESPACE_BEGIN(detail)
 
@@ -158,7 +295,8 @@ template <typename T, typename = int> struct ndarray_arg {
     static void apply(ndarray_req &) { }
 };
 
-template <typename T> struct ndarray_arg<T, enable_if_t<ndarray_traits<T>::is_float>> {
+template <typename T> struct ndarray_arg<T, enable_if_t<ndarray_traits<T>::is_float &&
+                                                        !is_bfloat16_v<T>>> {
     static constexpr size_t size = 0;
 
     static constexpr auto name =
@@ -173,6 +311,20 @@ template <typename T> struct ndarray_arg<T, enable_if_t<ndarray_traits<T>::is_fl
     }
 };
 
+template <typename T> struct ndarray_arg<T, enable_if_t<is_bfloat16_v<T>>> {
+    static constexpr size_t size = 0;
+
+    static constexpr auto name =
+        const_name("dtype=bfloat16") +
+        const_name<std::is_const_v<T>>(", writable=False", "");
+
+    static void apply(ndarray_req &tr) {
+        tr.dtype = dtype<T>();
+        tr.req_dtype = true;
+        tr.req_ro = std::is_const_v<T>;
+    }
+};
+
 template <typename T> struct ndarray_arg<T, enable_if_t<ndarray_traits<T>::is_complex>> {
     static constexpr size_t size = 0;
 
@@ -270,6 +422,7 @@ template <typename T> struct ndarray_arg<T, enable_if_t<T::is_device>> {
 template <typename... Ts> struct ndarray_info {
     using scalar_type = void;
     using shape_type = void;
+    constexpr static size_t ndim = any; // 'any': not constrained by the type
     constexpr static auto name = const_name("ndarray");
     constexpr static ndarray_framework framework = ndarray_framework::none;
     constexpr static char order = '\0';
@@ -284,6 +437,7 @@ template <typename T, typename... Ts> struct ndarray_info<T, Ts...>  : ndarray_i
 
 template <size_t... Is, typename... Ts> struct ndarray_info<shape<Is...>, Ts...> : ndarray_info<Ts...> {
     using shape_type = shape<Is...>;
+    constexpr static size_t ndim = sizeof...(Is);
 };
 
 template <typename... Ts> struct ndarray_info<c_contig, Ts...> : ndarray_info<Ts...> {
@@ -314,6 +468,34 @@ template <typename... Ts> struct ndarray_info<jax, Ts...> : ndarray_info<Ts...>
     constexpr static ndarray_framework framework = ndarray_framework::jax;
 };
 
+/// Does 'shape' satisfy the entries of a shape<..> annotation?
+template <size_t... I1, size_t... I2>
+bool ndarray_shape_matches(const size_t *s, std::index_sequence<I1...>,
+                           shape<I2...>) {
+    return ((I2 == any || s[I1] == I2) && ...);
+}
+
+/// Type of views created by ndarray::slice() etc.: drops shape and order annotations
+template <typename Result, typename... Ts> struct ndarray_view_type {
+    using type = Result;
+};
+
+template <typename... Rs, typename T, typename... Ts>
+struct ndarray_view_type<ndarray<Rs...>, T, Ts...>
+    : ndarray_view_type<ndarray<Rs..., T>, Ts...> { };
+
+template <typename... Rs, size_t... Is, typename... Ts>
+struct ndarray_view_type<ndarray<Rs...>, shape<Is...>, Ts...>
+    : ndarray_view_type<ndarray<Rs...>, Ts...> { };
+
+template <typename... Rs, typename... Ts>
+struct ndarray_view_type<ndarray<Rs...>, c_contig, Ts...>
+    : ndarray_view_type<ndarray<Rs...>, Ts...> { };
+
+template <typename... Rs, typename... Ts>
+struct ndarray_view_type<ndarray<Rs...>, f_contig, Ts...>
+    : ndarray_view_type<ndarray<Rs...>, Ts...> { };
+
 
 NAMESPACE_END(detail)
 
@@ -425,6 +607,98 @@ public:
         m_dltensor = *detail::ndarray_inc_ref(m_handle);
     }
 
+    /// Allocate an uninitialized array using nanobind's storage pool
+    static ndarray empty(size_t ndim, const size_t *shape,
+                         bool huge_pages = false) {
+        return alloc(ndim, shape, false, huge_pages);
+    }
+
+    static ndarray empty(std::initializer_list<size_t> shape,
+                         bool huge_pages = false) {
+        return alloc(shape.size(), shape.begin(), false, huge_pages);
+    }
+
+    /// Allocate a zero-initialized array using nanobind's storage pool
+    static ndarray zeros(size_t ndim, const size_t *shape,
+                         bool huge_pages = false) {
+        return alloc(ndim, shape, true, huge_pages);
+    }
+
+    static ndarray zeros(std::initializer_list<size_t> shape,
+                         bool huge_pages = false) {
+        return alloc(shape.size(), shape.begin(), true, huge_pages);
+    }
+
+    /**
+     * Memory-map a region of a file starting at byte 'offset'. Arrays with a
+     * 'const' scalar type use a read-only mapping, while all other arrays
+     * receive a private copy-on-write mapping.
+     */
+    static ndarray map_file(const char *filename, size_t ndim,
+                            const size_t *shape, uint64_t offset = 0,
+                            mmap_advice advice = mmap_advice::normal) {
+        return map(filename, ndim, shape, offset, advice);
+    }
+
+    static ndarray map_file(const char *filename,
+                            std::initializer_list<size_t> shape,
+                            uint64_t offset = 0,
+                            mmap_advice advice = mmap_advice::normal) {
+        return map(filename, shape.size(), shape.begin(), offset, advice);
+    }
+
+    /// Memory-map the remainder of a file as a 1D array
+    static ndarray map_file(const char *filename, uint64_t offset = 0,
+                            mmap_advice advice = mmap_advice::normal) {
+        static_assert(Info::ndim == any || Info::ndim == 1,
+                      "ndarray::map_file(): the overload without a shape "
+                      "creates 1D arrays, which conflicts with the shape<..> "
+                      "or ndim<..> annotation of this ndarray type.");
+        return map(filename, 1, nullptr, offset, advice);
+    }
+
+    /**
+     * The following functions return views that share the storage of this
+     * array without copying it. Their type lacks the shape, ``ndim``, and
+     * memory order annotations of this array, which may no longer hold.
+     * Convert the result to a suitably annotated type before indexing it via
+     * ``operator()``, e.g.:
+     * ``nb::ndarray<float, nb::ndim<1>> row(a.select(0, i));``
+     */
+    using View = typename detail::ndarray_view_type<ndarray<>, Args...>::type;
+
+    /// Python-style slice ``[start:stop:step]`` along 'axis'
+    View slice(size_t axis, int64_t start, int64_t stop,
+               int64_t step = 1) const {
+        return View(detail::ndarray_slice(m_handle, axis, start, stop, step));
+    }
+
+    /// Select entry 'index' along 'axis', which removes that axis
+    View select(size_t axis, int64_t index) const {
+        return View(detail::ndarray_select(m_handle, axis, index));
+    }
+
+    /// Reverse the order of all axes
+    View transpose() const {
+        return View(detail::ndarray_transpose(m_handle, 0, nullptr));
+    }
+
+    /// Permute the axes so that axis 'i' of the result is 'axes[i]'
+    View transpose(std::initializer_list<size_t> axes) const {
+        return View(
+            detail::ndarray_transpose(m_handle, axes.size(), axes.begin()));
+    }
+
+    /// Change the shape of a C- or F-contiguous array
+    View reshape(std::initializer_list<size_t> shape) const {
+        return View(
+            detail::ndarray_reshape(m_handle, shape.size(), shape.begin()));
+    }
+
+    View reshape(size_t ndim, const size_t *shape) const {
+        return View(detail::ndarray_reshape(m_handle, ndim, shape));
+    }
+
     ~ndarray() {
         detail::ndarray_dec_ref(m_handle);
     }
@@ -526,6 +800,72 @@ public:
     }
 
 private:
+    /// Is 'shape' compatible with the shape<..> or ndim<..> annotation?
+    static bool shape_compatible(size_t ndim, const size_t *shape) {
+        if constexpr (Info::ndim != any)
+            return ndim == Info::ndim &&
+                   detail::ndarray_shape_matches(
+                       shape, std::make_index_sequence<Info::ndim>(),
+                       typename Info::shape_type());
+        else
+            return true;
+    }
+
+    static ndarray alloc(size_t ndim, const size_t *shape, bool zero,
+                         bool huge_pages) {
+        static_assert(!std::is_same_v<Scalar, void>,
+                      "ndarray::empty()/zeros() require a scalar type "
+                      "annotation (e.g. 'float') in the ndarray template "
+                      "parameters.");
+
+        if (!shape_compatible(ndim, shape))
+            throw value_error("ndarray::empty()/zeros(): the requested shape "
+                              "is incompatible with the shape<..> or ndim<..> "
+                              "annotation of the ndarray type!");
+
+        ndarray result;
+        if constexpr (!std::is_same_v<Scalar, void>) {
+            dlpack::dtype dt = nanobind::dtype<Scalar>();
+            result.m_handle = detail::ndarray_alloc(
+                ndim, shape, &dt, Info::order == 'F' ? 'F' : 'C', zero,
+                huge_pages, std::is_const_v<Scalar>);
+            result.m_dltensor = *detail::ndarray_inc_ref(result.m_handle);
+        }
+        return result;
+    }
+
+    static ndarray map(const char *filename, size_t ndim, const size_t *shape,
+                       uint64_t offset, mmap_advice advice) {
+        static_assert(!std::is_same_v<Scalar, void>,
+                      "ndarray::map_file() requires a scalar type annotation "
+                      "(e.g. 'float') in the ndarray template parameters.");
+
+        const char *error = "ndarray::map_file(): the requested shape is "
+                            "incompatible with the shape<..> or ndim<..> "
+                            "annotation of the ndarray type!";
+
+        if (shape && !shape_compatible(ndim, shape))
+            throw value_error(error);
+
+        ndarray result;
+        if constexpr (!std::is_same_v<Scalar, void>) {
+            dlpack::dtype dt = nanobind::dtype<Scalar>();
+            result.m_handle = detail::ndarray_map_file(
+                filename, ndim, shape, &dt, Info::order == 'F' ? 'F' : 'C',
+                offset, !std::is_const_v<Scalar>, (int) advice);
+            result.m_dltensor = *detail::ndarray_inc_ref(result.m_handle);
+        }
+
+        // The size of 1D arrays without a given shape depends on the file
+        if (!shape) {
+            size_t size = result.shape(0);
+            if (!shape_compatible(1, &size))
+                throw value_error(error);
+        }
+
+        return result;
+    }
+
     template <typename... Ts>
     NB_INLINE int64_t byte_offset(Ts... indices) const {
         constexpr bool has_scalar = !std::is_same_v<Scalar, void>,
@@ -561,6 +901,50 @@ inline bool ndarray_check(handle h) { return detail::ndarray_check(h.ptr()); }
 
 NAMESPACE_BEGIN(detail)
 
+template <typename... Args>
+dlpack::dltensor ndarray_dltensor(const ndarray<Args...> &array) {
+    dlpack::dltensor t;
+    t.data = (void *) array.data();
+    t.device = { array.device_type(), array.device_id() };
+    t.ndim = (int32_t) array.ndim();
+    t.dtype = array.dtype();
+    t.shape = (int64_t *) array.shape_ptr();
+    t.strides = (int64_t *) array.stride_ptr();
+    return t;
+}
+
+NAMESPACE_END(detail)
+
+/**
+ * \brief Broadcast the given CPU ndarrays against each other and iterate over
+ * their elements.
+ *
+ * Dimensions that are laid out contiguously in all operands are coalesced, and
+ * the function 'func' is invoked once per inner loop with the signature
+ *
+ *     void func(void **ptrs, const int64_t *strides, size_t count);
+ *
+ * where 'ptrs[i]' points to the first element of operand 'i' and 'strides[i]'
+ * specifies its byte stride (0 for broadcast operands).
+ */
+template <typename Func, typename... Arrays>
+void nditer(Func &&func, const Arrays &...arrays) {
+    using FuncType = std::remove_reference_t<Func>;
+    const dlpack::dltensor tensors[] { detail::ndarray_dltensor(arrays)... };
+
+    detail::ndarray_iterate(
+        sizeof...(Arrays), tensors,
+        [](void *payload, void **ptrs, const int64_t *strides, size_t count) {
+            (*(FuncType *) payload)(ptrs, strides, count);
+        },
+        (void *) &func);
+}
+
+NAMESPACE_BEGIN(detail)
+
+template <typename... Args>
+struct is_python_object<ndarray<Args...>> : std::true_type { };
+
 template <typename... Args> struct type_caster<ndarray<Args...>> {
     NB_TYPE_CASTER(ndarray<Args...>, Value::Info::name + const_name("[") +
                                         concat_maybe(detail::ndarray_arg<Args>::name...) +
@@ -583,5 +967,125 @@ template <typename... Args> struct type_caster<ndarray<Args...>> {
     }
 };
 
+/* Describes (nested) numeric STL containers that can be returned via
+   nb::ret_array<..>. 'fixed' types (numbers and std::array) have a shape known
+   at compile time, and 'dense' types store their scalars contiguously. */
+template <typename T, typename = int> struct ret_array_info {
+    static constexpr bool valid = false;
+};
+
+template <typename T>
+struct ret_array_info<T, enable_if_t<std::is_arithmetic_v<T> && !is_std_char_v<T>>> {
+    using scalar = T;
+    static constexpr bool valid = true, fixed = true, dense = true;
+    static constexpr size_t ndim = 0;
+
+    static void get_shape(const T *, size_t *) { }
+    static bool copy(const T &value, const size_t *, T *&out) {
+        *out++ = value;
+        return true;
+    }
+};
+
+template <typename T, size_t N>
+struct ret_array_info<std::array<T, N>, enable_if_t<ret_array_info<T>::valid>> {
+    using Inner = ret_array_info<T>;
+    using scalar = typename Inner::scalar;
+    static constexpr bool valid = true, fixed = Inner::fixed, dense = fixed;
+    static constexpr size_t ndim = Inner::ndim + 1;
+
+    static void get_shape(const std::array<T, N> *v, size_t *shape) {
+        shape[0] = N;
+        Inner::get_shape(v && N > 0 ? v->data() : nullptr, shape + 1);
+    }
+
+    static bool copy(const std::array<T, N> &v, const size_t *shape, scalar *&out) {
+        for (const T &value : v) {
+            if (!Inner::copy(value, shape + 1, out))
+                return false;
+        }
+        return true;
+    }
+};
+
+template <typename T, typename A>
+struct ret_array_info<std::vector<T, A>,
+                      enable_if_t<ret_array_info<T>::valid && !std::is_same_v<T, bool>>> {
+    using Inner = ret_array_info<T>;
+    using scalar = typename Inner::scalar;
+    static constexpr bool valid = true, fixed = false, dense = Inner::fixed;
+    static constexpr size_t ndim = Inner::ndim + 1;
+
+    static void get_shape(const std::vector<T, A> *v, size_t *shape) {
+        shape[0] = v ? v->size() : 0;
+        if constexpr (Inner::ndim > 0) {
+            if (!v || v->empty()) {
+                for (size_t i = 1; i < ndim; ++i)
+                    shape[i] = 0;
+            }
+            Inner::get_shape(v && !v->empty() ? v->data() : nullptr, shape + 1);
+        }
+    }
+
+    static bool copy(const std::vector<T, A> &v, const size_t *shape, scalar *&out) {
+        if (v.size() != shape[0])
+            return false;
+        for (const T &value : v) {
+            if (!Inner::copy(value, shape + 1, out))
+                return false;
+        }
+        return true;
+    }
+};
+
+template <typename T, typename... As> struct ret_array_caster<T, ret_array<As...>> {
+    using Container = std::remove_cv_t<std::remove_reference_t<T>>;
+    using Info = ret_array_info<Container>;
+
+    static_assert(Info::valid && Info::ndim > 0,
+        "nb::ret_array<..>: the function must return a (nested) std::vector "
+        "or std::array of an arithmetic type!");
+
+    using Scalar = typename Info::scalar;
+    using Array = std::conditional_t<
+        sizeof...(As) == 0, ndarray<numpy, Scalar, ndim<Info::ndim>>,
+        ndarray<As..., Scalar, ndim<Info::ndim>>>;
+
+    static_assert(Array::Info::order != 'F',
+                  "nb::ret_array<..>: arrays are always C-contiguous!");
+
+    static constexpr auto Name = make_caster<Array>::Name;
+
+    template <typename T_>
+    static handle from_cpp(T_ &&value, rv_policy, cleanup_list *cleanup) {
+        size_t shape[Info::ndim];
+        Info::get_shape(&value, shape);
+
+        Array array;
+        if constexpr (!Info::fixed && Info::dense &&
+                      !std::is_lvalue_reference_v<T_>) {
+            // Adopt the storage of the returned vector
+            if (!value.empty()) {
+                Container *c = new Container(std::move(value));
+                capsule owner(c, [](void *p) noexcept {
+                    delete (Container *) p;
+                });
+                array = Array((void *) c->data(), Info::ndim, shape, owner);
+            }
+        }
+
+        if (!array.is_valid()) {
+            array = Array::empty(Info::ndim, shape);
+            Scalar *out = array.data();
+            if (!Info::copy(value, shape, out))
+                throw value_error("nb::ret_array<..>: nested containers must "
+                                  "have a rectangular shape!");
+        }
+
+        return make_caster<Array>::from_cpp(array, rv_policy::automatic,
+                                            cleanup);
+    }
+};
+
 NAMESPACE_END(detail)
 NAMESPACE_END(NB_NAMESPACE)
@@ -35,6 +35,49 @@ inline void map_set(Map &m, const Key &k, const Value &v) {
     }
 }
 
+template <typename T> using map_has_reserve = decltype(std::declval<T>().reserve(0));
+
+/// Insert the entries of a Python dictionary using a single key/value caster
+template <typename Map> void map_update(Map &m, handle src) {
+    using Key = typename Map::key_type;
+    using Value = typename Map::mapped_type;
+    using KeyCaster = make_caster<Key>;
+    using ValueCaster = make_caster<Value>;
+
+    uint8_t flags_key = (uint8_t) cast_flags::convert,
+            flags_value = (uint8_t) cast_flags::convert;
+
+    if constexpr (is_base_caster_v<KeyCaster> && !std::is_pointer_v<Key>)
+        flags_key |= (uint8_t) cast_flags::none_disallowed;
+    if constexpr (is_base_caster_v<ValueCaster> && !std::is_pointer_v<Value>)
+        flags_value |= (uint8_t) cast_flags::none_disallowed;
+
+    if constexpr (is_detected_v<map_has_reserve, Map>)
+        m.reserve(m.size() + (size_t) PyDict_Size(src.ptr()));
+
+    KeyCaster key_caster;
+    ValueCaster value_caster;
+    cleanup_list cleanup(nullptr);
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+
+    while (PyDict_Next(src.ptr(), &pos, &key, &value)) {
+        if (!key_caster.from_python(key, flags_key, &cleanup) ||
+            !value_caster.from_python(value, flags_value, &cleanup)) {
+            cleanup.release();
+            throw type_error("Could not convert an entry of the input "
+                             "dictionary to the map's key/value type!");
+        }
+
+        const Key &k = key_caster.operator cast_t<Key>();
+        const Value &v = value_caster.operator cast_t<Value>();
+        if (!m.emplace(k, v).second)
+            map_set<Map, Key, Value>(m, k, v);
+    }
+
+    cleanup.release();
+}
+
 NAMESPACE_END(detail)
 
 template <typename Map, typename... Args>
@@ -103,9 +146,9 @@ class_<Map> bind_map(handle scope, const char *name, Args &&...args) {
         cl.def(init<const Map &>(), "Copy constructor");
 
         cl.def("__init__", [](Map *m, typed<dict, detail::dict_type_id<Key, Value>> &d) {
-            new (m) Map();
-            for (auto [k, v] : d.value)
-                m->emplace(cast<Key>(k), cast<Value>(v));
+            Map tmp;
+            detail::map_update(tmp, d.value);
+            new (m) Map(std::move(tmp));
         }, "Construct from a dictionary");
 
         implicitly_convertible<dict, Map>();
@@ -123,6 +166,11 @@ class_<Map> bind_map(handle scope, const char *name, Args &&...args) {
                 detail::map_set<Map, Key, Value>(m, kv.first, kv.second);
         },
         "Update the map with element from `arg`");
+
+        cl.def("update", [](Map &m, typed<dict, detail::dict_type_id<Key, Value>> &d) {
+            detail::map_update(m, d.value);
+        },
+        "Update the map with element from `arg`");
     }
 
     if constexpr (detail::is_equality_comparable_v<Map>) {
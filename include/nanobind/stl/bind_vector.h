@@ -40,6 +40,180 @@ template <typename Value> struct iterable_type_id {
                                  const_name("]");
 };
 
+template <typename Vector>
+using vector_data_t = decltype(std::declval<Vector &>().data());
+
+/// Can the storage of a bound vector be exported via the buffer protocol?
+template <typename Vector, typename Value = typename Vector::value_type>
+constexpr bool vector_has_buffer_v =
+#if PY_VERSION_HEX >= 0x03090000
+    is_detected_v<vector_data_t, Vector> &&
+    std::is_trivially_copyable_v<Value> && !std::is_pointer_v<Value> &&
+    !std::is_same_v<Value, bool>;
+#else
+    false;
+#endif
+
+/// Are the entries of 'Vector' numbers stored contiguously?
+template <typename Vector, typename Value = typename Vector::value_type>
+constexpr bool vector_is_arith_v =
+    is_detected_v<vector_data_t, Vector> && std::is_arithmetic_v<Value> &&
+    !std::is_same_v<Value, bool> && !is_std_char_v<Value> &&
+    sizeof(Value) <= 8;
+
+[[noreturn]] inline void vector_extend_fail() {
+    throw type_error("Could not convert an element of the input sequence to "
+                     "the vector's value type!");
+}
+
+/**
+ * Append the entries of 'src' to 'v'. Lists and tuples are converted using a
+ * single element caster, and vectors of numbers additionally accept buffer
+ * objects in bulk. Other iterables are traversed element by element. If a
+ * conversion fails, the size of 'v' is restored and a TypeError is raised.
+ */
+template <typename Vector> void vector_extend(Vector &v, handle src) {
+    using Value = typename Vector::value_type;
+    using Caster = make_caster<Value>;
+    size_t size = v.size();
+
+    if constexpr (vector_is_arith_v<Vector>) {
+        struct payload { Vector *v; size_t offset; } p { &v, size };
+        bool success = load_seq_arith(
+            src.ptr(), (uint8_t) cast_flags::convert,
+            std::is_floating_point_v<Value> ? 'f'
+                : (std::is_signed_v<Value> ? 'i' : 'u'),
+            sizeof(Value),
+            [](void *ptr, size_t n) -> void * {
+                payload &p = *(payload *) ptr;
+                p.v->resize(p.offset + n);
+                return p.v->data() + p.offset;
+            }, &p);
+
+        if (success)
+            return;
+        v.resize(size);
+    }
+
+    uint8_t flags = (uint8_t) cast_flags::convert;
+    if constexpr (is_base_caster_v<Caster> && !std::is_pointer_v<Value>)
+        flags |= (uint8_t) cast_flags::none_disallowed;
+
+    PyObject *temp;
+    size_t n;
+    PyObject **items = seq_get(src.ptr(), &n, &temp);
+    object temp_o = steal(temp);
+
+    Caster caster;
+    if (items) {
+        v.reserve(size + n);
+        for (size_t i = 0; i < n; ++i) {
+            if (!caster.from_python(items[i], flags, nullptr)) {
+                v.erase(v.begin() + (std::ptrdiff_t) size, v.end());
+                vector_extend_fail();
+            }
+            v.push_back(caster.operator cast_t<Value>());
+        }
+    } else {
+        v.reserve(size + len_hint(src));
+        for (handle h : borrow<iterable>(src)) {
+            if (!caster.from_python(h.ptr(), flags, nullptr)) {
+                v.erase(v.begin() + (std::ptrdiff_t) size, v.end());
+                vector_extend_fail();
+            }
+            v.push_back(caster.operator cast_t<Value>());
+        }
+    }
+}
+
+/// Buffer protocol format of a vector entry ('nullptr': export raw bytes)
+template <typename T> constexpr const char *vector_format() {
+    if constexpr (std::is_floating_point_v<T>) {
+        return sizeof(T) == 4 ? "f" : sizeof(T) == 8 ? "d" : "g";
+    } else if constexpr (std::is_integral_v<T>) {
+        constexpr const char *fmt[2][4] = { { "B", "H", "I", "Q" },
+                                            { "b", "h", "i", "q" } };
+        constexpr size_t index = sizeof(T) == 1 ? 0 : sizeof(T) == 2 ? 1
+                               : sizeof(T) == 4 ? 2 : 3;
+        return fmt[std::is_signed_v<T>][index];
+    } else {
+        return nullptr;
+    }
+}
+
+/// Raise an exception if the vector 'h' is exported and must not be re-sized
+template <typename Vector> void vector_resize_guard(handle h) {
+    if constexpr (vector_has_buffer_v<Vector>) {
+        if (nb_inst_exports(h.ptr()))
+            throw buffer_error("Existing exports of data: object cannot be "
+                               "re-sized");
+    } else {
+        (void) h;
+    }
+}
+
+template <typename Vector>
+int vector_getbuffer(PyObject *exporter, Py_buffer *view, int) {
+    using Value = typename Vector::value_type;
+    constexpr const char *format = vector_format<Value>();
+
+    Vector *v = inst_ptr<Vector>(exporter);
+    if (!nb_inst_add_exports(exporter, 1)) {
+        PyErr_SetString(PyExc_BufferError, "Too many exports of data!");
+        return -1;
+    }
+
+    Py_ssize_t *info = (Py_ssize_t *) PyMem_Malloc(sizeof(Py_ssize_t) * 4);
+    if (!info) {
+        nb_inst_add_exports(exporter, -1);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    // Entries without a format code are exposed as a 2D array of bytes
+    Py_ssize_t *shape = info, *strides = info + 2;
+    shape[0] = (Py_ssize_t) v->size();
+    strides[0] = (Py_ssize_t) sizeof(Value);
+    shape[1] = (Py_ssize_t) sizeof(Value);
+    strides[1] = 1;
+
+    view->buf = v->empty() ? (void *) info : (void *) v->data();
+    view->obj = exporter;
+    Py_INCREF(exporter);
+    view->len = shape[0] * (Py_ssize_t) sizeof(Value);
+    view->readonly = 0;
+    view->itemsize = format ? (Py_ssize_t) sizeof(Value) : 1;
+    view->format = (char *) (format ? format : "B");
+    view->ndim = format ? 1 : 2;
+    view->shape = shape;
+    view->strides = strides;
+    view->suboffsets = nullptr;
+    view->internal = info;
+    return 0;
+}
+
+inline void vector_releasebuffer(PyObject *exporter, Py_buffer *view) {
+    nb_inst_add_exports(exporter, -1);
+    PyMem_Free(view->internal);
+}
+
+/**
+ * Install the buffer protocol slots. This uses a callback so that the
+ * bindings can additionally receive a user-provided 'type_slots' annotation.
+ */
+template <typename Vector>
+void vector_buffer_slots(const type_init_data *, PyType_Slot *&slots,
+                         size_t max_slots) noexcept {
+#if PY_VERSION_HEX >= 0x03090000
+    if (max_slots >= 2) {
+        *slots++ = { Py_bf_getbuffer, (void *) vector_getbuffer<Vector> };
+        *slots++ = { Py_bf_releasebuffer, (void *) vector_releasebuffer };
+    }
+#else
+    (void) slots; (void) max_slots;
+#endif
+}
+
 NAMESPACE_END(detail)
 
 
@@ -54,8 +228,23 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
         return borrow<class_<Vector>>(cl_cur);
     }
 
-    auto cl = class_<Vector>(scope, name, std::forward<Args>(args)...)
-        .def(init<>(), "Default constructor")
+    auto cl = [&] {
+        if constexpr (detail::vector_has_buffer_v<Vector>) {
+            static_assert(
+                !(std::is_same_v<std::decay_t<Args>, type_slots_callback> || ...),
+                "bind_vector(): the bindings of this vector type install a "
+                "type_slots_callback to support the buffer protocol, which "
+                "conflicts with the provided type_slots_callback annotation. "
+                "Use the type_slots annotation instead.");
+            return class_<Vector>(
+                scope, name,
+                type_slots_callback(detail::vector_buffer_slots<Vector>),
+                std::forward<Args>(args)...);
+        } else
+            return class_<Vector>(scope, name, std::forward<Args>(args)...);
+    }();
+
+    cl.def(init<>(), "Default constructor")
 
         .def("__len__", [](const Vector &v) { return v.size(); })
 
@@ -80,7 +269,12 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
              },
              rv_policy::reference_internal)
 
-        .def("clear", [](Vector &v) { v.clear(); },
+        .def("clear",
+             [](pointer_and_handle<Vector> vh) {
+                 Vector &v = *vh.p;
+                 detail::vector_resize_guard<Vector>(vh.h);
+                 v.clear();
+             },
              "Remove all items from list.");
 
     if constexpr (detail::is_copy_constructible_v<Value>) {
@@ -88,31 +282,38 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
                "Copy constructor");
 
         cl.def("__init__", [](Vector *v, typed<iterable, detail::iterable_type_id<Value>> &seq) {
-            new (v) Vector();
-            v->reserve(len_hint(seq.value));
-            for (handle h : seq.value)
-                v->push_back(cast<Value>(h));
+            Vector result;
+            detail::vector_extend(result, seq.value);
+            new (v) Vector(std::move(result));
         }, "Construct from an iterable object");
 
         implicitly_convertible<iterable, Vector>();
 
         cl.def("append",
-               [](Vector &v, const Value &value) { v.push_back(value); },
+               [](pointer_and_handle<Vector> vh, const Value &value) {
+                   Vector &v = *vh.p;
+                   detail::vector_resize_guard<Vector>(vh.h);
+                   v.push_back(value);
+               },
                "Append `arg` to the end of the list.")
 
           .def("insert",
-               [](Vector &v, Py_ssize_t i, const Value &x) {
+               [](pointer_and_handle<Vector> vh, Py_ssize_t i, const Value &x) {
+                   Vector &v = *vh.p;
                    if (i < 0)
                        i += (Py_ssize_t) v.size();
                    if (i < 0 || (size_t) i > v.size())
                        throw index_error();
+                   detail::vector_resize_guard<Vector>(vh.h);
                    v.insert(v.begin() + i, x);
                },
                "Insert object `arg1` before index `arg0`.")
 
            .def("pop",
-                [](Vector &v, Py_ssize_t i) {
+                [](pointer_and_handle<Vector> vh, Py_ssize_t i) {
+                    Vector &v = *vh.p;
                     size_t index = detail::wrap(i, v.size());
+                    detail::vector_resize_guard<Vector>(vh.h);
                     Value result = std::move(v[index]);
                     v.erase(v.begin() + index);
                     return result;
@@ -121,24 +322,41 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
                 "Remove and return item at `index` (default last).")
 
           .def("extend",
-               [](Vector &v, const Vector &src) {
+               [](pointer_and_handle<Vector> vh, const Vector &src) {
+                   Vector &v = *vh.p;
+                   detail::vector_resize_guard<Vector>(vh.h);
                    v.insert(v.end(), src.begin(), src.end());
                },
                "Extend `self` by appending elements from `arg`.")
 
+          .def("extend",
+               [](pointer_and_handle<Vector> vh, typed<iterable, detail::iterable_type_id<Value>> &seq) {
+                   Vector &v = *vh.p;
+                   detail::vector_resize_guard<Vector>(vh.h);
+                   detail::vector_extend(v, seq.value);
+               },
+               "Extend `self` by appending elements from `arg`.")
+
           .def("__setitem__",
                [](Vector &v, Py_ssize_t i, const Value &value) {
                    v[detail::wrap(i, v.size())] = value;
                })
 
           .def("__delitem__",
-               [](Vector &v, Py_ssize_t i) {
-                   v.erase(v.begin() + detail::wrap(i, v.size()));
+               [](pointer_and_handle<Vector> vh, Py_ssize_t i) {
+                   Vector &v = *vh.p;
+                   size_t index = detail::wrap(i, v.size());
+                   detail::vector_resize_guard<Vector>(vh.h);
+                   v.erase(v.begin() + index);
                })
 
           .def("__getitem__",
                [](const Vector &v, const slice &slice) -> Vector * {
                    auto [start, stop, step, length] = slice.compute(v.size());
+                   if (step == 1)
+                       return new Vector(v.begin() + start,
+                                         v.begin() + start + length);
+
                    auto *seq = new Vector();
                    seq->reserve(length);
 
@@ -166,11 +384,13 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
                })
 
           .def("__delitem__",
-               [](Vector &v, const slice &slice) {
+               [](pointer_and_handle<Vector> vh, const slice &slice) {
+                   Vector &v = *vh.p;
                    auto [start, stop, step, length] = slice.compute(v.size());
                    if (length == 0)
                        return;
 
+                   detail::vector_resize_guard<Vector>(vh.h);
                    stop = start + (length - 1) * step;
                    if (start > stop) {
                        std::swap(start, stop);
@@ -180,10 +400,17 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
                    if (step == 1) {
                        v.erase(v.begin() + start, v.begin() + stop + 1);
                    } else {
-                       for (size_t i = 0; i < length; ++i) {
-                           v.erase(v.begin() + stop);
-                           stop -= step;
+                       // Compact the remaining entries in a single pass
+                       size_t out = start, next = start, k = 0;
+                       for (size_t i = start; i < v.size(); ++i) {
+                           if (k < length && i == next) {
+                               next += step;
+                               k++;
+                               continue;
+                           }
+                           v[out++] = std::move(v[i]);
                        }
+                       v.erase(v.begin() + out, v.end());
                    }
                });
     }
@@ -206,12 +433,15 @@ class_<Vector> bind_vector(handle scope, const char *name, Args &&...args) {
                }, "Return number of occurrences of `arg`.")
 
           .def("remove",
-               [](Vector &v, const Value &x) {
+               [](pointer_and_handle<Vector> vh, const Value &x) {
+                   Vector &v = *vh.p;
                    auto p = std::find(v.begin(), v.end(), x);
-                   if (p != v.end())
+                   if (p != v.end()) {
+                       detail::vector_resize_guard<Vector>(vh.h);
                        v.erase(p);
-                   else
+                   } else {
                        throw value_error();
+                   }
                },
                "Remove first occurrence of `arg`.");
     }
@@ -21,7 +21,9 @@
 #include <cmath>
 #include <ctime>
 #include <limits>
+#include <vector>
 
+#include <nanobind/stl/detail/nb_list.h>
 #include <nanobind/stl/detail/chrono.h>
 
 // Casts a std::chrono type (either a duration or a time_point) to/from
@@ -223,5 +225,123 @@ template <typename Rep, typename Period>
 class type_caster<std::chrono::duration<Rep, Period>>
   : public duration_caster<std::chrono::duration<Rep, Period>> {};
 
+// Days since 1970-01-01 of a date in the proleptic Gregorian calendar
+constexpr int64_t days_from_civil(int64_t y, int64_t m, int64_t d) {
+    y -= m <= 2;
+    int64_t era = (y >= 0 ? y : y - 399) / 400,
+            yoe = y - era * 400,
+            doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1,
+            doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Inverse of days_from_civil()
+inline void civil_from_days(int64_t z, int64_t *y, int64_t *m, int64_t *d) {
+    z += 719468;
+    int64_t era = (z >= 0 ? z : z - 146096) / 146097,
+            doe = z - era * 146097,
+            yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365,
+            doy = doe - (365 * yoe + yoe / 4 - yoe / 100),
+            mp = (5 * doy + 2) / 153;
+    *d = doy - (153 * mp + 2) / 5 + 1;
+    *m = mp < 10 ? mp + 3 : mp - 9;
+    *y = yoe + era * 400 + (*m <= 2);
+}
+
+// Split nanoseconds into whole seconds and a non-negative remainder
+inline int64_t split_ns(int64_t ns, int64_t *rem) {
+    int64_t s = ns / 1000000000;
+    *rem = ns % 1000000000;
+    if (*rem < 0) {
+        *rem += 1000000000;
+        s -= 1;
+    }
+    return s;
+}
+
+// Like datetime.datetime objects, 'datetime64' values are naive wall clock
+// times, which are interpreted in the local time zone (see the caster above).
+// This function converts such a value into nanoseconds since the epoch.
+inline int64_t datetime64_to_system(int64_t ns) {
+    int64_t rem, s = split_ns(ns, &rem),
+            days = (s >= 0 ? s : s - 86399) / 86400, sod = s - days * 86400,
+            y, m, d;
+    civil_from_days(days, &y, &m, &d);
+
+    std::tm cal{};
+    cal.tm_year = (int) (y - 1900);
+    cal.tm_mon = (int) (m - 1);
+    cal.tm_mday = (int) d;
+    cal.tm_hour = (int) (sod / 3600);
+    cal.tm_min = (int) (sod / 60 % 60);
+    cal.tm_sec = (int) (sod % 60);
+    cal.tm_isdst = -1;
+
+    return (int64_t) std::mktime(&cal) * 1000000000 + rem;
+}
+
+// Inverse of datetime64_to_system()
+inline int64_t system_to_datetime64(int64_t ns) {
+    int64_t rem, s = split_ns(ns, &rem);
+    std::time_t tt = (std::time_t) s;
+    std::tm cal;
+    if (!localtime_thread_safe(&tt, &cal))
+        throw value_error("Unable to represent system_clock in local time!");
+
+    int64_t days = days_from_civil(cal.tm_year + 1900, cal.tm_mon + 1,
+                                   cal.tm_mday);
+    return ((days * 24 + cal.tm_hour) * 60 + cal.tm_min) * 60 * 1000000000 +
+           (int64_t) cal.tm_sec * 1000000000 + rem;
+}
+
+// Vectors of system clock time points additionally accept one-dimensional
+// NumPy 'datetime64' arrays, which are converted in bulk without creating
+// a Python object per entry.
+template <typename Duration, typename Alloc>
+struct type_caster<std::vector<
+    std::chrono::time_point<std::chrono::system_clock, Duration>, Alloc>>
+  : list_caster<std::vector<std::chrono::time_point<
+                                std::chrono::system_clock, Duration>, Alloc>,
+                std::chrono::time_point<std::chrono::system_clock, Duration>> {
+    using TimePoint = std::chrono::time_point<std::chrono::system_clock, Duration>;
+    using List = std::vector<TimePoint, Alloc>;
+    using Base = list_caster<List, TimePoint>;
+
+    bool from_python(handle src, uint8_t flags, cleanup_list *cleanup) noexcept {
+        if (load_datetime64(src.ptr(), store, &this->value))
+            return true;
+        return Base::from_python(src, flags, cleanup);
+    }
+
+    static void store(void *p, const int64_t *data, size_t size) {
+        List &list = *(List *) p;
+        list.resize(size);
+        for (size_t i = 0; i < size; ++i)
+            list[i] = TimePoint(std::chrono::duration_cast<Duration>(
+                std::chrono::nanoseconds(datetime64_to_system(data[i]))));
+    }
+};
+
 NAMESPACE_END(detail)
+
+/**
+ * Convert a vector of system clock time points into a NumPy 'datetime64[ns]'
+ * array in a single pass. Like the conversion to 'datetime.datetime', entries
+ * are stored as naive times in the local time zone.
+ */
+template <typename Duration, typename Alloc>
+object datetime64_array(
+    const std::vector<std::chrono::time_point<std::chrono::system_clock,
+                                              Duration>, Alloc> &v) {
+    int64_t *data;
+    object result = steal(detail::datetime64_new(v.size(), &data));
+
+    for (size_t i = 0; i < v.size(); ++i)
+        data[i] = detail::system_to_datetime64(
+            (int64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                v[i].time_since_epoch()).count());
+
+    return result;
+}
+
 NAMESPACE_END(NB_NAMESPACE)
@@ -58,51 +58,19 @@ PyObject* pack_datetime(int year, int month, int day,
 // because we don't want the bloat of actually inlining them. They are
 // defined in this header instead of in the built nanobind library in
 // order to avoid increasing the library size for users who don't care
-// about datetimes.
+// about datetimes. Only the 'datetime' module objects are shared via
+// datetime_api_get(), which imports them once per interpreter.
 
 #if defined(Py_LIMITED_API) || defined(PYPY_VERSION)
 
-struct datetime_types_t {
-    // Types defined by the datetime module
-    handle datetime;
-    handle time;
-    handle date;
-    handle timedelta;
-
-    // Ensure that the above four handles point to valid Python objects.
-    // If unable, throw nb::python_error.
-    void ensure_ready() {
-        if (datetime.is_valid())
-            return;
-
-        object mod = module_::import_("datetime");
-        object datetime_o = mod.attr("datetime");
-        object time_o = mod.attr("time");
-        object date_o = mod.attr("date");
-        object timedelta_o = mod.attr("timedelta");
-
-        // Leak references to these datetime types. We could improve upon
-        // this by storing them in the internals structure and decref'ing
-        // in internals_cleanup(), but it doesn't seem worthwhile for
-        // something this fundamental. We can't store nb::object in this
-        // structure because it might be destroyed after the Python
-        // interpreter has finalized.
-        datetime = datetime_o.release();
-        time = time_o.release();
-        date = date_o.release();
-        timedelta = timedelta_o.release();
-    }
-};
-
-inline datetime_types_t datetime_types;
-
-// Set *dest to the integer value of getattr(o, name). Returns true
-// on success, false and sets the Python error indicator on failure.
-// The attribute value must be a Python integer object; other types
-// of numbers are not supported.
+// Set *dest to the integer value of getattr(o, name), where 'name' is
+// one of the interned strings in datetime_api. Returns true on success,
+// false and sets the Python error indicator on failure. The attribute
+// value must be a Python integer object; other types of numbers are
+// not supported.
 NB_NOINLINE inline bool set_from_int_attr(int *dest, PyObject *o,
-                                          const char *name) noexcept {
-    PyObject *value = PyObject_GetAttrString(o, name);
+                                          PyObject *name) noexcept {
+    PyObject *value = PyObject_GetAttr(o, name);
     if (!value)
         return false;
     long lval = PyLong_AsLong(value);
@@ -113,7 +81,7 @@ NB_NOINLINE inline bool set_from_int_attr(int *dest, PyObject *o,
     if (lval < std::numeric_limits<int>::min() ||
         lval > std::numeric_limits<int>::max()) {
         PyErr_Format(PyExc_OverflowError,
-                     "%R attribute '%s' (%R) does not fit in an int",
+                     "%R attribute '%U' (%R) does not fit in an int",
                      o, name, value);
         Py_DECREF(value);
         return false;
@@ -125,12 +93,11 @@ NB_NOINLINE inline bool set_from_int_attr(int *dest, PyObject *o,
 
 NB_NOINLINE inline bool unpack_timedelta(PyObject *o, int *days,
                                          int *secs, int *usecs) {
-    datetime_types.ensure_ready();
-    if (PyType_IsSubtype(Py_TYPE(o),
-                         (PyTypeObject *) datetime_types.timedelta.ptr())) {
-        if (!set_from_int_attr(days, o, "days") ||
-            !set_from_int_attr(secs, o, "seconds") ||
-            !set_from_int_attr(usecs, o, "microseconds")) {
+    const datetime_api *api = datetime_api_get();
+    if (PyType_IsSubtype(Py_TYPE(o), (PyTypeObject *) api->timedelta)) {
+        if (!set_from_int_attr(days, o, api->days) ||
+            !set_from_int_attr(secs, o, api->seconds) ||
+            !set_from_int_attr(usecs, o, api->microseconds)) {
             raise_python_error();
         }
         return true;
@@ -142,39 +109,36 @@ NB_NOINLINE inline bool unpack_datetime(PyObject *o,
                                         int *year, int *month, int *day,
                                         int *hour, int *minute, int *second,
                                         int *usec) {
-    datetime_types.ensure_ready();
-    if (PyType_IsSubtype(Py_TYPE(o),
-                         (PyTypeObject *) datetime_types.datetime.ptr())) {
-        if (!set_from_int_attr(usec, o, "microsecond") ||
-            !set_from_int_attr(second, o, "second") ||
-            !set_from_int_attr(minute, o, "minute") ||
-            !set_from_int_attr(hour, o, "hour") ||
-            !set_from_int_attr(day, o, "day") ||
-            !set_from_int_attr(month, o, "month") ||
-            !set_from_int_attr(year, o, "year")) {
+    const datetime_api *api = datetime_api_get();
+    if (PyType_IsSubtype(Py_TYPE(o), (PyTypeObject *) api->datetime)) {
+        if (!set_from_int_attr(usec, o, api->microsecond) ||
+            !set_from_int_attr(second, o, api->second) ||
+            !set_from_int_attr(minute, o, api->minute) ||
+            !set_from_int_attr(hour, o, api->hour) ||
+            !set_from_int_attr(day, o, api->day) ||
+            !set_from_int_attr(month, o, api->month) ||
+            !set_from_int_attr(year, o, api->year)) {
             raise_python_error();
         }
         return true;
     }
-    if (PyType_IsSubtype(Py_TYPE(o),
-                         (PyTypeObject *) datetime_types.date.ptr())) {
+    if (PyType_IsSubtype(Py_TYPE(o), (PyTypeObject *) api->date)) {
         *usec = *second = *minute = *hour = 0;
-        if (!set_from_int_attr(day, o, "day") ||
-            !set_from_int_attr(month, o, "month") ||
-            !set_from_int_attr(year, o, "year")) {
+        if (!set_from_int_attr(day, o, api->day) ||
+            !set_from_int_attr(month, o, api->month) ||
+            !set_from_int_attr(year, o, api->year)) {
             raise_python_error();
         }
         return true;
     }
-    if (PyType_IsSubtype(Py_TYPE(o),
-                         (PyTypeObject *) datetime_types.time.ptr())) {
+    if (PyType_IsSubtype(Py_TYPE(o), (PyTypeObject *) api->time)) {
         *day = 1;
         *month = 1;
         *year = 1970;
-        if (!set_from_int_attr(usec, o, "microsecond") ||
-            !set_from_int_attr(second, o, "second") ||
-            !set_from_int_attr(minute, o, "minute") ||
-            !set_from_int_attr(hour, o, "hour")) {
+        if (!set_from_int_attr(usec, o, api->microsecond) ||
+            !set_from_int_attr(second, o, api->second) ||
+            !set_from_int_attr(minute, o, api->minute) ||
+            !set_from_int_attr(hour, o, api->hour)) {
             raise_python_error();
         }
         return true;
@@ -184,8 +148,8 @@ NB_NOINLINE inline bool unpack_datetime(PyObject *o,
 
 inline PyObject* pack_timedelta(int days, int secs, int usecs) noexcept {
     try {
-        datetime_types.ensure_ready();
-        return datetime_types.timedelta(days, secs, usecs).release().ptr();
+        const datetime_api *api = datetime_api_get();
+        return handle(api->timedelta)(days, secs, usecs).release().ptr();
     } catch (python_error& e) {
         e.restore();
         return nullptr;
@@ -196,8 +160,8 @@ inline PyObject* pack_datetime(int year, int month, int day,
                                int hour, int minute, int second,
                                int usec) noexcept {
     try {
-        datetime_types.ensure_ready();
-        return datetime_types.datetime(
+        const datetime_api *api = datetime_api_get();
+        return handle(api->datetime)(
                 year, month, day, hour, minute, second, usec).release().ptr();
     } catch (python_error& e) {
         e.restore();
@@ -207,13 +171,17 @@ inline PyObject* pack_datetime(int year, int month, int day,
 
 #else // !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
 
+// <datetime.h> declares a separate 'PyDateTimeAPI' pointer in every
+// translation unit. Initialize it from the table imported once per
+// interpreter instead of importing the capsule again.
+NB_INLINE void datetime_api_ready() {
+    if (NB_UNLIKELY(!PyDateTimeAPI))
+        PyDateTimeAPI = (PyDateTime_CAPI *) datetime_api_get()->capi;
+}
+
 NB_NOINLINE inline bool unpack_timedelta(PyObject *o, int *days,
                                          int *secs, int *usecs) {
-    if (!PyDateTimeAPI) {
-        PyDateTime_IMPORT;
-        if (!PyDateTimeAPI)
-            raise_python_error();
-    }
+    datetime_api_ready();
     if (PyDelta_Check(o)) {
         *days = PyDateTime_DELTA_GET_DAYS(o);
         *secs = PyDateTime_DELTA_GET_SECONDS(o);
@@ -227,11 +195,7 @@ NB_NOINLINE inline bool unpack_datetime(PyObject *o,
                                         int *year, int *month, int *day,
                                         int *hour, int *minute, int *second,
                                         int *usec) {
-    if (!PyDateTimeAPI) {
-        PyDateTime_IMPORT;
-        if (!PyDateTimeAPI)
-            raise_python_error();
-    }
+    datetime_api_ready();
     if (PyDateTime_Check(o)) {
         *usec = PyDateTime_DATE_GET_MICROSECOND(o);
         *second = PyDateTime_DATE_GET_SECOND(o);
@@ -266,10 +230,11 @@ NB_NOINLINE inline bool unpack_datetime(PyObject *o,
 }
 
 inline PyObject* pack_timedelta(int days, int secs, int usecs) noexcept {
-    if (!PyDateTimeAPI) {
-        PyDateTime_IMPORT;
-        if (!PyDateTimeAPI)
-            return nullptr;
+    try {
+        datetime_api_ready();
+    } catch (python_error &e) {
+        e.restore();
+        return nullptr;
     }
     return PyDelta_FromDSU(days, secs, usecs);
 }
@@ -277,10 +242,11 @@ inline PyObject* pack_timedelta(int days, int secs, int usecs) noexcept {
 inline PyObject* pack_datetime(int year, int month, int day,
                                int hour, int minute, int second,
                                int usec) noexcept {
-    if (!PyDateTimeAPI) {
-        PyDateTime_IMPORT;
-        if (!PyDateTimeAPI)
-            return nullptr;
+    try {
+        datetime_api_ready();
+    } catch (python_error &e) {
+        e.restore();
+        return nullptr;
     }
     return PyDateTime_FromDateAndTime(year, month, day,
                                       hour, minute, second, usec);
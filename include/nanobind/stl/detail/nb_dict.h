@@ -22,18 +22,11 @@ template <typename Dict, typename Key, typename Val> struct dict_caster {
     using KeyCaster = make_caster<Key>;
     using ValCaster = make_caster<Val>;
 
+    template <typename T> using has_reserve = decltype(std::declval<T>().reserve(0));
+
     bool from_python(handle src, uint8_t flags, cleanup_list *cleanup) noexcept {
         value.clear();
 
-        PyObject *items = PyMapping_Items(src.ptr());
-        if (items == nullptr) {
-            PyErr_Clear();
-            return false;
-        }
-
-        Py_ssize_t size = NB_LIST_GET_SIZE(items);
-        bool success = size >= 0;
-
         uint8_t flags_key = flags, flags_val = flags;
 
         if constexpr (is_base_caster_v<KeyCaster> && !std::is_pointer_v<Key>)
@@ -43,23 +36,52 @@ template <typename Dict, typename Key, typename Val> struct dict_caster {
 
         KeyCaster key_caster;
         ValCaster val_caster;
-        for (Py_ssize_t i = 0; i < size; ++i) {
-            PyObject *item = NB_LIST_GET_ITEM(items, i);
-            PyObject *key = NB_TUPLE_GET_ITEM(item, 0);
-            PyObject *val = NB_TUPLE_GET_ITEM(item, 1);
 
-            if (!key_caster.from_python(key, flags_key, cleanup)) {
-                success = false;
-                break;
+        auto insert = [&](PyObject *key, PyObject *val) -> bool {
+            if (!key_caster.from_python(key, flags_key, cleanup) ||
+                !val_caster.from_python(val, flags_val, cleanup))
+                return false;
+
+            value.emplace(key_caster.operator cast_t<Key>(),
+                          val_caster.operator cast_t<Val>());
+            return true;
+        };
+
+        if (PyDict_CheckExact(src.ptr())) {
+            // Fast path: walk the hash table without creating an item list
+            if constexpr (is_detected_v<has_reserve, Dict>)
+                value.reserve((size_t) PyDict_Size(src.ptr()));
+
+            PyObject *key, *val;
+            Py_ssize_t pos = 0;
+            while (PyDict_Next(src.ptr(), &pos, &key, &val)) {
+                if (!insert(key, val))
+                    return false;
             }
 
-            if (!val_caster.from_python(val, flags_val, cleanup)) {
+            return true;
+        }
+
+        PyObject *items = PyMapping_Items(src.ptr());
+        if (items == nullptr) {
+            PyErr_Clear();
+            return false;
+        }
+
+        Py_ssize_t size = NB_LIST_GET_SIZE(items);
+        bool success = size >= 0;
+
+        if constexpr (is_detected_v<has_reserve, Dict>) {
+            if (success)
+                value.reserve((size_t) size);
+        }
+
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            PyObject *item = NB_LIST_GET_ITEM(items, i);
+            if (!insert(NB_TUPLE_GET_ITEM(item, 0), NB_TUPLE_GET_ITEM(item, 1))) {
                 success = false;
                 break;
             }
-
-            value.emplace(key_caster.operator cast_t<Key>(),
-                          val_caster.operator cast_t<Val>());
         }
 
         Py_DECREF(items);
@@ -69,7 +91,7 @@ template <typename Dict, typename Key, typename Val> struct dict_caster {
 
     template <typename T>
     static handle from_cpp(T &&src, rv_policy policy, cleanup_list *cleanup) {
-        dict ret;
+        dict ret = steal<dict>(dict_new_presized(src.size()));
 
         if (ret.is_valid()) {
             for (auto &item : src) {
@@ -21,8 +21,30 @@ template <typename List, typename Entry> struct list_caster {
     using Caster = make_caster<Entry>;
 
     template <typename T> using has_reserve = decltype(std::declval<T>().reserve(0));
+    template <typename T> using has_data = decltype(std::declval<T>().data());
+
+    /// Contiguous containers of numbers support bulk loading
+    static constexpr bool is_arith =
+        is_detected_v<has_data, List> &&
+        std::is_same_v<Caster, type_caster<Entry>> &&
+        std::is_arithmetic_v<Entry> && !std::is_same_v<Entry, bool> &&
+        !is_std_char_v<Entry> && (sizeof(Entry) <= 8);
 
     bool from_python(handle src, uint8_t flags, cleanup_list *cleanup) noexcept {
+        if constexpr (is_arith) {
+            (void) cleanup;
+            return load_seq_arith(
+                src.ptr(), flags,
+                std::is_floating_point_v<Entry> ? 'f'
+                    : (std::is_signed_v<Entry> ? 'i' : 'u'),
+                sizeof(Entry),
+                [](void *p, size_t size) -> void * {
+                    List &list = *(List *) p;
+                    list.resize(size);
+                    return list.data();
+                }, &value);
+        }
+
         size_t size;
         PyObject *temp;
 
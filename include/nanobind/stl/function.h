@@ -11,6 +11,10 @@
 
 #include <nanobind/nanobind.h>
 #include <functional>
+#include <iterator>
+#include <mutex>
+#include <tuple>
+#include <vector>
 
 NAMESPACE_BEGIN(NB_NAMESPACE)
 NAMESPACE_BEGIN(detail)
@@ -34,16 +38,34 @@ struct pyfunc_wrapper {
     }
 
     ~pyfunc_wrapper() {
-        if (f) {
-            gil_scoped_acquire acq;
-            Py_DECREF(f);
-        }
+        if (f)
+            dec_ref_deferred(f);
     }
 
     pyfunc_wrapper &operator=(const pyfunc_wrapper) = delete;
     pyfunc_wrapper &operator=(pyfunc_wrapper &&) = delete;
 };
 
+/// Acquires the GIL unless the calling thread already holds it
+struct pyfunc_gil {
+#if !defined(Py_LIMITED_API)
+    pyfunc_gil() noexcept : held(PyGILState_Check()) {
+        if (!held)
+            state = PyGILState_Ensure();
+    }
+
+    ~pyfunc_gil() {
+        if (!held)
+            PyGILState_Release(state);
+    }
+
+    bool held;
+    PyGILState_STATE state;
+#else
+    gil_scoped_acquire acq;
+#endif
+};
+
 template <typename Return, typename... Args>
 struct type_caster<std::function<Return(Args...)>> {
     using ReturnCaster = make_caster<
@@ -57,9 +79,39 @@ struct type_caster<std::function<Return(Args...)>> {
     struct pyfunc_wrapper_t : pyfunc_wrapper {
         using pyfunc_wrapper::pyfunc_wrapper;
 
+        /// Entry point of a bound C++ function with a matching signature
+        Return (*direct)(void *, Args...) = nullptr;
+        size_t offset = 0;
+
+        /// Cached vectorcall entry point of Python callables
+        void *vectorcall = nullptr;
+
         Return operator()(Args... args) const {
-            gil_scoped_acquire acq;
-            return cast<Return>(handle(f)((forward_t<Args>) args...));
+            /* Call nb::direct() functions without acquiring the GIL or
+               converting arguments. Such functions cannot be overloaded,
+               hence the captured callable remains at a fixed location. */
+            if (direct)
+                return direct((char *) f + offset, (forward_t<Args>) args...);
+
+            pyfunc_gil gil;
+
+            // Converted arguments are released if a later conversion throws
+            object args_o[sizeof...(Args) + 1];
+            size_t nargs = 0;
+            ((args_o[1 + nargs++] = steal(
+                  make_caster<Args>::from_cpp((forward_t<Args>) args,
+                                              rv_policy::automatic_reference,
+                                              nullptr))), ...);
+
+            PyObject *args_py[sizeof...(Args) + 1];
+            for (size_t i = 1; i <= nargs; ++i)
+                args_py[i] = args_o[i].release().ptr();
+
+            object result = steal(obj_vectorcall_cached(f, vectorcall,
+                                                        args_py, nargs));
+
+            if constexpr (!std::is_void_v<Return>)
+                return cast<Return>(result);
         }
     };
 
@@ -70,7 +122,16 @@ struct type_caster<std::function<Return(Args...)>> {
         if (!PyCallable_Check(src.ptr()))
             return false;
 
-        value = pyfunc_wrapper_t(src.ptr());
+        pyfunc_wrapper_t wrapper(src.ptr());
+
+        void (*direct)();
+        if (nb_func_get_direct(src.ptr(), &typeid(Return (*)(Args...)),
+                               &direct, &wrapper.offset))
+            wrapper.direct = (Return (*)(void *, Args...)) direct;
+        else
+            wrapper.vectorcall = obj_vectorcall_get(src.ptr());
+
+        value = std::move(wrapper);
 
         return true;
     }
@@ -92,4 +153,95 @@ struct type_caster<std::function<Return(Args...)>> {
 };
 
 NAMESPACE_END(detail)
+
+template <typename Signature> class batched_function;
+
+/**
+ * Queues invocations of a callback and delivers them in batches of
+ * 'batch_size' calls, which share a single GIL acquisition when the callback
+ * is implemented in Python. Arguments are copied into the queue. The object
+ * may be invoked from multiple threads.
+ */
+template <typename... Args> class batched_function<void(Args...)> {
+public:
+    batched_function(std::function<void(Args...)> func, size_t batch_size)
+        : m_func(std::move(func)), m_batch_size(batch_size ? batch_size : 1) { }
+
+    batched_function(const batched_function &) = delete;
+    batched_function &operator=(const batched_function &) = delete;
+
+    /// Deliver pending calls, errors are reported as unraisable
+    ~batched_function() {
+        if (m_queue.empty() || !is_alive())
+            return;
+
+        const char *context = "nanobind::batched_function::~batched_function()";
+        detail::pyfunc_gil gil;
+        while (!m_queue.empty()) {
+            std::vector<Entry> batch;
+            batch.swap(m_queue);
+            try {
+                deliver(batch);
+            } catch (python_error &e) {
+                e.discard_as_unraisable(context);
+            } catch (const std::exception &e) {
+                PyErr_SetString(PyExc_RuntimeError, e.what());
+                python_error().discard_as_unraisable(context);
+            } catch (...) {
+                PyErr_SetString(PyExc_RuntimeError, "unknown C++ exception");
+                python_error().discard_as_unraisable(context);
+            }
+        }
+    }
+
+    /// Queue a call, and deliver the batch once it is complete
+    void operator()(Args... args) {
+        std::vector<Entry> batch;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_queue.emplace_back((detail::forward_t<Args>) args...);
+            if (m_queue.size() < m_batch_size)
+                return;
+            batch.swap(m_queue);
+        }
+        deliver(batch);
+    }
+
+    /// Deliver all pending calls
+    void flush() {
+        std::vector<Entry> batch;
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            batch.swap(m_queue);
+        }
+        if (!batch.empty())
+            deliver(batch);
+    }
+
+private:
+    using Entry = std::tuple<std::decay_t<Args>...>;
+
+    /// Deliver a batch. When a call fails, the remaining ones are queued again
+    void deliver(std::vector<Entry> &batch) {
+        size_t i = 0;
+        try {
+            detail::pyfunc_gil gil;
+            for (; i < batch.size(); ++i)
+                std::apply(m_func, batch[i]);
+        } catch (...) {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_queue.insert(m_queue.begin(),
+                           std::make_move_iterator(batch.begin() + i + 1),
+                           std::make_move_iterator(batch.end()));
+            throw;
+        }
+    }
+
+private:
+    std::function<void(Args...)> m_func;
+    size_t m_batch_size;
+    std::mutex m_mutex;
+    std::vector<Entry> m_queue;
+};
+
 NAMESPACE_END(NB_NAMESPACE)
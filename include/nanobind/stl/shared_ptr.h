@@ -21,8 +21,7 @@ struct py_deleter {
         // Don't run the deleter if the interpreter has been shut down
         if (!Py_IsInitialized())
             return;
-        gil_scoped_acquire guard;
-        Py_DECREF(o);
+        dec_ref_deferred(o);
     }
 
     PyObject *o;
@@ -51,6 +50,40 @@ shared_from_python(T *ptr, handle h) noexcept {
         return std::shared_ptr<T>(nullptr);
 }
 
+inline void shared_cache_free(void *p) noexcept {
+    delete (std::weak_ptr<void> *) p;
+}
+
+/**
+ * Variant of shared_from_python() for instances whose C++ object is embedded
+ * in or referenced by the Python object 'h'. The control block is cached in
+ * a weak_ptr next to the instance (via keep_alive()), so that repeated
+ * conversions of the same object share ownership and only increase a
+ * reference count. The returned shared_ptr aliases the control block, which
+ * is needed since 'ptr' may refer to a base class subobject.
+ */
+inline NB_NOINLINE std::shared_ptr<void>
+shared_from_python_cached(void *ptr, handle h) noexcept {
+    std::weak_ptr<void> *cache = (std::weak_ptr<void> *)
+        keep_alive_payload(h.ptr(), shared_cache_free);
+
+    std::shared_ptr<void> base;
+    if (cache)
+        base = cache->lock();
+
+    if (!base) {
+        base = std::shared_ptr<void>(nb_inst_ptr(h.ptr()),
+                                     py_deleter{ h.inc_ref().ptr() });
+        if (cache)
+            *cache = base;
+        else
+            keep_alive(h.ptr(), new std::weak_ptr<void>(base),
+                       shared_cache_free);
+    }
+
+    return std::shared_ptr<void>(base, ptr);
+}
+
 inline NB_NOINLINE void shared_from_cpp(std::shared_ptr<void> &&ptr,
                                         PyObject *o) noexcept {
     keep_alive(o, new std::shared_ptr<void>(std::move(ptr)),
@@ -73,6 +106,7 @@ template <typename T> struct type_caster<std::shared_ptr<T>> {
     bool from_python(handle src, uint8_t flags,
                      cleanup_list *cleanup) noexcept {
         Caster caster;
+        size_t cleanup_size = cleanup ? cleanup->size() : 0;
         if (!caster.from_python(src, flags, cleanup))
             return false;
 
@@ -89,7 +123,11 @@ template <typename T> struct type_caster<std::shared_ptr<T>> {
             // so that future calls to ptr->shared_from_this() can share
             // ownership with it.
             value = shared_from_python(ptr, src);
+        } else if (ptr && (!cleanup || cleanup->size() == cleanup_size)) {
+            value = std::static_pointer_cast<T>(
+                shared_from_python_cached((void *) ptr, src));
         } else {
+            // Implicit conversions produce a temporary that cannot be cached
             value = std::static_pointer_cast<T>(
                 shared_from_python(static_cast<void *>(ptr), src));
         }
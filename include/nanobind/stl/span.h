@@ -0,0 +1,94 @@
+/*
+    nanobind/stl/span.h: type caster for std::span<...>
+
+    Copyright (c) 2023 Wenzel Jakob
+
+    All rights reserved. Use of this source code is governed by a
+    BSD-style license that can be found in the LICENSE file.
+*/
+
+#pragma once
+
+#include <nanobind/nanobind.h>
+#include <cstddef>
+#include <span>
+
+NAMESPACE_BEGIN(NB_NAMESPACE)
+NAMESPACE_BEGIN(detail)
+
+/**
+ * Spans borrow the memory of 'bytes', 'bytearray', 'memoryview', and other
+ * C-contiguous buffer protocol objects (e.g., NumPy arrays) without copying
+ * it. The underlying buffer is held until the function call has finished.
+ * Spans of non-const elements require a writable buffer.
+ */
+template <typename T> struct type_caster<std::span<T>> {
+    using Entry = std::remove_cv_t<T>;
+
+    /// Spans of byte-sized entries accept any buffer and view it as raw bytes
+    static constexpr bool is_byte =
+        std::is_same_v<Entry, std::byte> || std::is_same_v<Entry, char> ||
+        std::is_same_v<Entry, signed char> ||
+        std::is_same_v<Entry, unsigned char>;
+
+    static_assert(is_byte || (std::is_arithmetic_v<Entry> &&
+                              !std::is_same_v<Entry, bool>),
+                  "std::span<T> type caster: T must be a byte or number type!");
+
+    NB_TYPE_CASTER(std::span<T>,
+                   const_name<is_byte>(
+                       const_name<std::is_const_v<T>>("bytes", "bytearray"),
+                       const_name("collections.abc.Buffer")));
+
+    bool from_python(handle src, uint8_t, cleanup_list *cleanup) noexcept {
+        void *data;
+        size_t size, itemsize;
+        char kind;
+
+        if (!buffer_get(src.ptr(), !std::is_const_v<T>, cleanup, &data,
+                        &size, &itemsize, &kind))
+            return false;
+
+        if constexpr (!is_byte) {
+            constexpr char expected =
+                std::is_floating_point_v<Entry>
+                    ? 'f' : (std::is_signed_v<Entry> ? 'i' : 'u');
+            if (kind != expected || itemsize != sizeof(Entry))
+                return false;
+        }
+
+        value = std::span<T>((T *) data, size / sizeof(Entry));
+        return true;
+    }
+
+    static handle from_cpp(std::span<T> value, rv_policy policy,
+                           cleanup_list *cleanup) {
+        if constexpr (is_byte) {
+            (void) policy; (void) cleanup;
+            return PyBytes_FromStringAndSize((const char *) value.data(),
+                                             (Py_ssize_t) value.size());
+        } else {
+            object ret = steal(PyList_New((Py_ssize_t) value.size()));
+
+            if (ret.is_valid()) {
+                Py_ssize_t index = 0;
+
+                for (const Entry &e : value) {
+                    handle h = make_caster<Entry>::from_cpp(e, policy, cleanup);
+
+                    if (!h.is_valid()) {
+                        ret.reset();
+                        break;
+                    }
+
+                    NB_LIST_SET_ITEM(ret.ptr(), index++, h.ptr());
+                }
+            }
+
+            return ret.release();
+        }
+    }
+};
+
+NAMESPACE_END(detail)
+NAMESPACE_END(NB_NAMESPACE)
@@ -16,9 +16,26 @@ NAMESPACE_BEGIN(NB_NAMESPACE)
 NAMESPACE_BEGIN(detail)
 
 template <> struct type_caster<std::string_view> {
-    NB_TYPE_CASTER(std::string_view, const_name("str"));
+    NB_TYPE_CASTER(std::string_view, io_name("Union[str, bytes]", "str"));
+
+    bool from_python(handle src, uint8_t flags, cleanup_list *cleanup) noexcept {
+        if (!PyUnicode_Check(src.ptr())) {
+            /* Borrow the memory of bytes-like objects without copying it. This
+               only happens in the implicit conversion pass so that overloads
+               taking 'nb::bytes' or 'nb::ndarray<..>' take precedence. */
+            if (!(flags & (uint8_t) cast_flags::convert))
+                return false;
+
+            void *data;
+            size_t size, itemsize;
+            char kind;
+            if (!buffer_get(src.ptr(), false, cleanup, &data, &size,
+                            &itemsize, &kind))
+                return false;
+            value = std::string_view((const char *) data, size);
+            return true;
+        }
 
-    bool from_python(handle src, uint8_t, cleanup_list *) noexcept {
         Py_ssize_t size;
         const char *str = PyUnicode_AsUTF8AndSize(src.ptr(), &size);
         if (!str) {
@@ -31,7 +48,7 @@ template <> struct type_caster<std::string_view> {
 
     static handle from_cpp(std::string_view value, rv_policy,
                            cleanup_list *) noexcept {
-        return PyUnicode_FromStringAndSize(value.data(), value.size());
+        return str_from_utf8(value.data(), value.size());
     }
 };
 
@@ -65,8 +65,94 @@ template <typename... Ts> struct type_caster<std::variant<Ts...>> {
         return true;
     }
 
+    /// Does the alternative 'T' reject all objects of type 'tp', regardless of their value?
+    template <typename T>
+    static bool rejects_type(PyTypeObject *tp, uint8_t flags) noexcept {
+        if constexpr (is_base_caster_v<make_caster<T>>)
+            return nb_type_rejects(&typeid(intrinsic_t<T>), tp,
+                                   flags & (uint8_t) cast_flags::convert);
+        else
+            return false;
+    }
+
+    /// Try the alternative with index 'index'
+    template <size_t... Is>
+    bool try_index(size_t index, handle src, uint8_t flags,
+                   cleanup_list *cleanup, std::index_sequence<Is...>) {
+        return ((Is == index && try_variant<Ts>(src, flags, cleanup)) || ...);
+    }
+
+    /// Try an alternative and track if all failed ones so far rejected the type
+    template <typename T>
+    bool try_alternative(handle src, uint8_t flags, cleanup_list *cleanup,
+                         size_t &index, bool &by_type) {
+        if (try_variant<T>(src, flags, cleanup))
+            return true;
+        if (by_type)
+            by_type = rejects_type<T>(Py_TYPE(src.ptr()), flags);
+        index++;
+        return false;
+    }
+
+    /**
+     * Memoizes the index of the alternative that accepted an object of a
+     * given Python type, for each of the two dispatch passes. An entry is
+     * only recorded when all preceding alternatives reject this type
+     * regardless of the value (e.g., bound types that the object is not an
+     * instance of), which preserves the first-match semantics. The memoized
+     * alternative may still reject a particular value, in which case all
+     * alternatives are tried in order. Only static types and nanobind types
+     * are cached. The latter are invalidated via nb_type_epoch(), since the
+     * address of a destroyed type can be reused.
+     */
+    struct cache_entry {
+        PyTypeObject *type;
+        size_t epoch;
+        size_t index;
+        uint8_t convert;
+    };
+
+    static constexpr size_t cache_size = 8;
+    static inline cache_entry cache[cache_size] { };
+
+    /// Return the memoized alternative for 'tp' (used by the test suite), or -1
+    static int cached_index(PyTypeObject *tp, bool convert) noexcept {
+        const cache_entry &e = cache[((uintptr_t) tp >> 4) % cache_size];
+        if (e.type == tp && e.convert == (uint8_t) convert &&
+            e.epoch == nb_type_epoch())
+            return (int) e.index;
+        return -1;
+    }
+
     bool from_python(handle src, uint8_t flags, cleanup_list *cleanup) noexcept {
-        return (try_variant<Ts>(src, flags, cleanup) || ...);
+        if constexpr (sizeof...(Ts) < 3) {
+            return (try_variant<Ts>(src, flags, cleanup) || ...);
+        } else {
+            PyTypeObject *tp = Py_TYPE(src.ptr());
+            uint8_t convert = flags & (uint8_t) cast_flags::convert;
+            size_t epoch = nb_type_epoch();
+
+            cache_entry &e = cache[((uintptr_t) tp >> 4) % cache_size];
+            bool hit = e.type == tp && e.convert == convert && e.epoch == epoch;
+
+            if (hit && try_index(e.index, src, flags, cleanup,
+                                 std::index_sequence_for<Ts...>()))
+                return true;
+
+            size_t index = 0;
+            bool by_type = true,
+                 success = (try_alternative<Ts>(src, flags, cleanup, index,
+                                                by_type) || ...);
+
+            if (success && by_type &&
+                (!(PyType_GetFlags(tp) & Py_TPFLAGS_HEAPTYPE) ||
+                 nb_type_check((PyObject *) tp)))
+                e = cache_entry{ tp, epoch, index, convert };
+            else if (hit)
+                e.type = nullptr;
+
+            return success;
+        }
     }
 
     template <typename T>
@@ -18,16 +18,19 @@ NAMESPACE_BEGIN(detail)
 struct ticket;
 
 NB_CORE void trampoline_new(void **data, size_t size, void *ptr) noexcept;
-NB_CORE void trampoline_release(void **data, size_t size) noexcept;
 NB_CORE void trampoline_enter(void **data, size_t size, const char *name,
                               bool pure, ticket *ticket);
 NB_CORE void trampoline_leave(ticket *ticket) noexcept;
 
+/**
+ * Refers to the Python instance associated with a trampoline. Override
+ * lookups are cached per Python type, and 'Size' only serves as a hint for
+ * the number of virtual functions that this cache should initially hold.
+ */
 template <size_t Size> struct trampoline {
-    mutable void *data[2 * Size + 1];
+    mutable void *data[1];
 
     NB_INLINE trampoline(void *ptr) { trampoline_new(data, Size, ptr); }
-    NB_INLINE ~trampoline() { trampoline_release(data, Size); }
 
     NB_INLINE handle base() const { return (PyObject *) data[0]; }
 };
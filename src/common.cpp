@@ -325,6 +325,57 @@ end:
     return res;
 }
 
+void *obj_vectorcall_get(PyObject *o) noexcept {
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION) && PY_VERSION_HEX >= 0x03090000
+    return (void *) PyVectorcall_Function(o);
+#else
+    (void) o;
+    return nullptr;
+#endif
+}
+
+PyObject *obj_vectorcall_cached(PyObject *o, void *vectorcall,
+                                PyObject **args, size_t nargs) {
+    PyObject *res = nullptr;
+    bool cast_error = false;
+
+    for (size_t i = 1; i <= nargs; ++i) {
+        if (!args[i]) {
+            cast_error = true;
+            break;
+        }
+    }
+
+    if (!cast_error) {
+        size_t nargsf = nargs | NB_VECTORCALL_ARGUMENTS_OFFSET;
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION) && PY_VERSION_HEX >= 0x03090000
+        if (vectorcall) {
+            res = ((vectorcallfunc) vectorcall)(o, args + 1, nargsf, nullptr);
+            if (!res && !PyErr_Occurred())
+                PyErr_SetString(PyExc_SystemError,
+                                "nanobind::detail::obj_vectorcall_cached(): "
+                                "callable returned NULL without an error!");
+        } else
+#endif
+        {
+            (void) vectorcall;
+            res = NB_VECTORCALL(o, args + 1, nargsf, nullptr);
+        }
+    }
+
+    for (size_t i = 1; i <= nargs; ++i)
+        Py_XDECREF(args[i]);
+
+    if (!res) {
+        if (cast_error)
+            raise_cast_error();
+        else
+            raise_python_error();
+    }
+
+    return res;
+}
+
 
 PyObject *obj_iter(PyObject *o) {
     PyObject *result = PyObject_GetIter(o);
@@ -541,6 +592,68 @@ PyObject *str_from_cstr_and_size(const char *str, size_t size) {
     return result;
 }
 
+PyObject *str_from_utf8(const char *str, size_t size) noexcept {
+    str_cache *cache = internals->nb_str_cache;
+    if (!cache || size > cache->max_length)
+        return PyUnicode_FromStringAndSize(str, (Py_ssize_t) size);
+
+    // FNV-1a hash of the string contents
+    size_t hash = (size_t) 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < size; ++i)
+        hash = (hash ^ (uint8_t) str[i]) * (size_t) 0x100000001b3ull;
+
+    str_cache::entry &e = cache->entries[hash & cache->mask];
+    if (e.str && e.hash == hash) {
+        Py_ssize_t size_2;
+        const char *str_2 = PyUnicode_AsUTF8AndSize(e.str, &size_2);
+        if (str_2 && (size_t) size_2 == size && memcmp(str, str_2, size) == 0) {
+            Py_INCREF(e.str);
+            return e.str;
+        }
+        PyErr_Clear();
+    }
+
+    PyObject *result = PyUnicode_FromStringAndSize(str, (Py_ssize_t) size);
+    if (!result)
+        return nullptr;
+
+    /* Don't intern 'result': this makes strings immortal on Python 3.12+,
+       which would leak every string evicted from the cache */
+    Py_XDECREF(e.str);
+    Py_INCREF(result);
+    e.str = result;
+    e.hash = hash;
+
+    return result;
+}
+
+void set_string_interning(size_t max_length, size_t capacity) noexcept {
+    str_cache *cache = internals->nb_str_cache;
+
+    if (cache) {
+        for (size_t i = 0; i <= cache->mask; ++i)
+            Py_XDECREF(cache->entries[i].str);
+        free(cache);
+        internals->nb_str_cache = nullptr;
+    }
+
+    if (max_length == 0 || capacity == 0)
+        return;
+
+    size_t size = 1;
+    while (size < capacity)
+        size *= 2;
+
+    cache = (str_cache *) calloc(
+        1, sizeof(str_cache) + (size - 1) * sizeof(str_cache::entry));
+    if (!cache)
+        fail("nanobind::detail::set_string_interning(): out of memory!");
+
+    cache->max_length = max_length;
+    cache->mask = size - 1;
+    internals->nb_str_cache = cache;
+}
+
 // ========================================================================
 
 PyObject *bytes_from_obj(PyObject *o) {
@@ -596,6 +709,16 @@ PyObject *list_from_obj(PyObject *o) {
     return result;
 }
 
+PyObject *dict_new_presized(size_t size) noexcept {
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION) && PY_VERSION_HEX < 0x030D0000
+    // Avoids repeated resizing of the hash table while inserting entries
+    if (size > 5)
+        return _PyDict_NewPresized((Py_ssize_t) size);
+#endif
+    (void) size;
+    return PyDict_New();
+}
+
 // ========================================================================
 
 PyObject **seq_get(PyObject *seq, size_t *size_out, PyObject **temp_out) noexcept {
@@ -1014,6 +1137,460 @@ bool load_i64(PyObject *o, uint8_t flags, int64_t *out) noexcept {
 
 // ========================================================================
 
+template <typename T>
+static bool load_seq_items(PyObject **items, size_t size, uint8_t flags,
+                           T *out) noexcept {
+    for (size_t i = 0; i < size; ++i) {
+        bool success;
+        if constexpr (std::is_same_v<T, double>)
+            success = load_f64(items[i], flags, out + i);
+        else if constexpr (std::is_same_v<T, float>)
+            success = load_f32(items[i], flags, out + i);
+        else
+            success = load_int(items[i], flags, out + i);
+
+        if (NB_UNLIKELY(!success))
+            return false;
+    }
+    return true;
+}
+
+/// Convert a strided buffer of 'Src' values into 'Dst' values
+template <typename Dst, typename Src>
+static bool load_buffer_items(const uint8_t *ptr, Py_ssize_t stride,
+                              size_t size, Dst *out) noexcept {
+    for (size_t i = 0; i < size; ++i) {
+        Src value;
+        memcpy(&value, ptr + (Py_ssize_t) i * stride, sizeof(Src));
+
+        if constexpr (std::is_integral_v<Dst>) {
+            // Reject values that are not representable in the target type
+            if constexpr (std::is_signed_v<Src> && std::is_unsigned_v<Dst>) {
+                if (value < 0)
+                    return false;
+            }
+
+            Dst value_d = (Dst) value;
+            if ((Src) value_d != value ||
+                (std::is_signed_v<Dst> != std::is_signed_v<Src> &&
+                 (value_d < 0) != (value < 0)))
+                return false;
+            out[i] = value_d;
+        } else {
+            out[i] = (Dst) value;
+        }
+    }
+    return true;
+}
+
+/* Returns 1 on success, 0 on failure, and -1 if the buffer format is
+   unsupported (the caller should then fall back to element-wise loading). */
+template <typename Dst>
+static int load_buffer(const Py_buffer &view, char kind, Dst *out) noexcept {
+    const uint8_t *ptr = (const uint8_t *) view.buf;
+    Py_ssize_t stride = view.strides[0];
+    size_t size = (size_t) view.shape[0];
+
+    if (kind == 'f') {
+        // Floating point values are only converted to floating point targets
+        if constexpr (std::is_floating_point_v<Dst>) {
+            if (view.itemsize == 8)
+                return load_buffer_items<Dst, double>(ptr, stride, size, out);
+            else if (view.itemsize == 4)
+                return load_buffer_items<Dst, float>(ptr, stride, size, out);
+        }
+        return -1;
+    }
+
+    bool is_signed = kind == 'i';
+    bool rv;
+    switch (view.itemsize) {
+        case 1: rv = is_signed ? load_buffer_items<Dst, int8_t>(ptr, stride, size, out)
+                               : load_buffer_items<Dst, uint8_t>(ptr, stride, size, out); break;
+        case 2: rv = is_signed ? load_buffer_items<Dst, int16_t>(ptr, stride, size, out)
+                               : load_buffer_items<Dst, uint16_t>(ptr, stride, size, out); break;
+        case 4: rv = is_signed ? load_buffer_items<Dst, int32_t>(ptr, stride, size, out)
+                               : load_buffer_items<Dst, uint32_t>(ptr, stride, size, out); break;
+        case 8: rv = is_signed ? load_buffer_items<Dst, int64_t>(ptr, stride, size, out)
+                               : load_buffer_items<Dst, uint64_t>(ptr, stride, size, out); break;
+        default: return -1;
+    }
+    return rv ? 1 : 0;
+}
+
+/// Classify a buffer format string as 'i', 'u', 'f', or '\0' (unsupported)
+static char buffer_format_kind(const char *format) noexcept {
+    if (!format)
+        return 'u'; // Plain bytes ('B')
+
+    char c = *format;
+#if PY_BIG_ENDIAN
+    if (c == '>' || c == '!')
+#else
+    if (c == '<')
+#endif
+        c = *++format;
+    else if (c == '@' || c == '=')
+        c = *++format;
+
+    if (c == '\0' || format[1] != '\0')
+        return '\0';
+
+    switch (c) {
+        case 'b': case 'h': case 'i': case 'l': case 'q': case 'n':
+            return 'i';
+        case 'B': case 'H': case 'I': case 'L': case 'Q': case 'N':
+            return 'u';
+        case 'f': case 'd':
+            return 'f';
+        default:
+            return '\0';
+    }
+}
+
+template <typename T>
+static bool load_seq_arith_impl(PyObject *o, uint8_t flags,
+                                load_seq_resize_cb resize,
+                                void *payload) noexcept {
+    /* Bulk path for one-dimensional buffers. This is restricted to implicit
+       conversion mode, where the element-wise path accepts the same inputs
+       (e.g., NumPy scalars). */
+    if ((flags & (uint8_t) cast_flags::convert) && PyObject_CheckBuffer(o) &&
+        !PyBytes_Check(o) && !PyByteArray_Check(o)) {
+        Py_buffer view;
+        if (PyObject_GetBuffer(o, &view, PyBUF_STRIDES | PyBUF_FORMAT) == 0) {
+            int rv = -1;
+            char kind = buffer_format_kind(view.format);
+
+            if (view.ndim == 1 && kind != '\0') {
+                T *out = (T *) resize(payload, (size_t) view.shape[0]);
+
+                if (kind == (std::is_floating_point_v<T> ? 'f' : std::is_signed_v<T> ? 'i' : 'u') &&
+                    (size_t) view.itemsize == sizeof(T)) {
+                    const uint8_t *ptr = (const uint8_t *) view.buf;
+                    if (view.strides[0] == (Py_ssize_t) sizeof(T)) {
+                        memcpy(out, ptr, sizeof(T) * (size_t) view.shape[0]);
+                    } else {
+                        for (Py_ssize_t i = 0; i < view.shape[0]; ++i)
+                            memcpy(out + i, ptr + i * view.strides[0], sizeof(T));
+                    }
+                    rv = 1;
+                } else {
+                    rv = load_buffer(view, kind, out);
+                }
+            }
+
+            PyBuffer_Release(&view);
+            if (rv >= 0)
+                return rv == 1;
+        } else {
+            PyErr_Clear();
+        }
+    }
+
+    size_t size;
+    PyObject *temp;
+    PyObject **items = seq_get(o, &size, &temp);
+    bool success = items != nullptr;
+
+    if (success)
+        success = load_seq_items(items, size, flags,
+                                 (T *) resize(payload, size));
+
+    Py_XDECREF(temp);
+    return success;
+}
+
+bool load_seq_arith(PyObject *o, uint8_t flags, char kind, size_t size,
+                    load_seq_resize_cb resize, void *payload) noexcept {
+    switch (kind) {
+        case 'f':
+            if (size == 8)
+                return load_seq_arith_impl<double>(o, flags, resize, payload);
+            else if (size == 4)
+                return load_seq_arith_impl<float>(o, flags, resize, payload);
+            break;
+
+        case 'i':
+            switch (size) {
+                case 1: return load_seq_arith_impl<int8_t>(o, flags, resize, payload);
+                case 2: return load_seq_arith_impl<int16_t>(o, flags, resize, payload);
+                case 4: return load_seq_arith_impl<int32_t>(o, flags, resize, payload);
+                case 8: return load_seq_arith_impl<int64_t>(o, flags, resize, payload);
+            }
+            break;
+
+        case 'u':
+            switch (size) {
+                case 1: return load_seq_arith_impl<uint8_t>(o, flags, resize, payload);
+                case 2: return load_seq_arith_impl<uint16_t>(o, flags, resize, payload);
+                case 4: return load_seq_arith_impl<uint32_t>(o, flags, resize, payload);
+                case 8: return load_seq_arith_impl<uint64_t>(o, flags, resize, payload);
+            }
+            break;
+    }
+
+    return false;
+}
+
+bool buffer_get(PyObject *o, bool writable, cleanup_list *cleanup,
+                void **data_out, size_t *size_out, size_t *itemsize_out,
+                char *kind_out) noexcept {
+    /* Like seq_get(), this function is used during overload resolution and
+       fails gracefully without reporting errors. */
+
+    if (!writable && PyBytes_CheckExact(o)) {
+        char *data;
+        Py_ssize_t size;
+        if (PyBytes_AsStringAndSize(o, &data, &size)) {
+            PyErr_Clear();
+            return false;
+        }
+        *data_out = data;
+        *size_out = (size_t) size;
+        *itemsize_out = 1;
+        *kind_out = 'u';
+        return true;
+    }
+
+    // Other exporters may move their storage once the buffer is released
+    if (!cleanup || PyUnicode_Check(o))
+        return false;
+
+    Py_buffer *view = (Py_buffer *) PyMem_Malloc(sizeof(Py_buffer));
+    if (!view) {
+        PyErr_Clear();
+        return false;
+    }
+
+    int flags = PyBUF_FORMAT | PyBUF_C_CONTIGUOUS;
+    if (writable)
+        flags |= PyBUF_WRITABLE;
+
+    if (PyObject_GetBuffer(o, view, flags)) {
+        PyErr_Clear();
+        PyMem_Free(view);
+        return false;
+    }
+
+    PyObject *capsule = PyCapsule_New(view, nullptr, [](PyObject *o) {
+        Py_buffer *view = (Py_buffer *) PyCapsule_GetPointer(o, nullptr);
+        PyBuffer_Release(view);
+        PyMem_Free(view);
+    });
+
+    if (!capsule) {
+        PyErr_Clear();
+        PyBuffer_Release(view);
+        PyMem_Free(view);
+        return false;
+    }
+
+    // The buffer stays acquired until the function call has finished
+    cleanup->append(capsule);
+
+    *data_out = view->buf;
+    *size_out = (size_t) view->len;
+    *itemsize_out = (size_t) view->itemsize;
+    *kind_out = buffer_format_kind(view->format);
+    return true;
+}
+
+static void nb_buffer_dealloc(PyObject *self) {
+    nb_buffer *b = (nb_buffer *) self;
+    if (b->deleter)
+        b->deleter(b->payload);
+
+    PyTypeObject *tp = Py_TYPE(self);
+    PyObject_Free(self);
+    Py_DECREF(tp);
+}
+
+static int nb_buffer_getbuffer(PyObject *exporter, Py_buffer *view, int flags) {
+    nb_buffer *b = (nb_buffer *) exporter;
+    return PyBuffer_FillInfo(view, exporter, b->data, b->size, b->readonly,
+                             flags);
+}
+
+static PyTypeObject *nb_buffer_tp() noexcept {
+    PyTypeObject *tp = internals->nb_buffer;
+
+    if (NB_UNLIKELY(!tp)) {
+        PyType_Slot slots[] = {
+            { Py_tp_dealloc, (void *) nb_buffer_dealloc },
+#if PY_VERSION_HEX >= 0x03090000
+            { Py_bf_getbuffer, (void *) nb_buffer_getbuffer },
+#endif
+            { 0, nullptr }
+        };
+
+        PyType_Spec spec = {
+            /* .name = */ "nanobind.nb_buffer",
+            /* .basicsize = */ (int) sizeof(nb_buffer),
+            /* .itemsize = */ 0,
+            /* .flags = */ Py_TPFLAGS_DEFAULT,
+            /* .slots = */ slots
+        };
+
+        tp = (PyTypeObject *) PyType_FromSpec(&spec);
+        check(tp, "nb_buffer type creation failed!");
+
+#if PY_VERSION_HEX < 0x03090000
+        tp->tp_as_buffer->bf_getbuffer = nb_buffer_getbuffer;
+#endif
+
+        internals->nb_buffer = tp;
+    }
+
+    return tp;
+}
+
+PyObject *buffer_new(void *data, size_t size, bool readonly, void *payload,
+                     void (*deleter)(void *) noexcept) noexcept {
+    nb_buffer *b = PyObject_New(nb_buffer, nb_buffer_tp());
+    if (!b) {
+        if (deleter)
+            deleter(payload);
+        return nullptr;
+    }
+
+    b->data = data;
+    b->size = (Py_ssize_t) size;
+    b->readonly = readonly;
+    b->payload = payload;
+    b->deleter = deleter;
+
+    // The memoryview holds the only reference to the owner object
+    PyObject *result = PyMemoryView_FromObject((PyObject *) b);
+    Py_DECREF(b);
+    return result;
+}
+
+// ========================================================================
+
+const datetime_api *datetime_api_get() {
+    datetime_api *api = internals->nb_datetime_api;
+    if (NB_LIKELY(api))
+        return api;
+
+    object mod = module_::import_("datetime");
+
+    datetime_api tmp;
+#if !defined(PYPY_VERSION)
+    tmp.capi = PyCapsule_Import("datetime.datetime_CAPI", 0);
+    if (!tmp.capi)
+        raise_python_error();
+#else
+    tmp.capi = nullptr;
+#endif
+
+    tmp.datetime = getattr(mod, "datetime").release().ptr();
+    tmp.date = getattr(mod, "date").release().ptr();
+    tmp.time = getattr(mod, "time").release().ptr();
+    tmp.timedelta = getattr(mod, "timedelta").release().ptr();
+
+    PyObject **names[] = { &tmp.days, &tmp.seconds, &tmp.microseconds,
+                           &tmp.year, &tmp.month, &tmp.day, &tmp.hour,
+                           &tmp.minute, &tmp.second, &tmp.microsecond };
+    const char *name_str[] = { "days", "seconds", "microseconds", "year",
+                               "month", "day", "hour", "minute", "second",
+                               "microsecond" };
+
+    for (size_t i = 0; i < sizeof(names) / sizeof(PyObject **); ++i) {
+        *names[i] = PyUnicode_InternFromString(name_str[i]);
+        if (!*names[i])
+            raise_python_error();
+    }
+
+    /* The references held by this table are intentionally leaked: they are
+       needed until the interpreter shuts down, at which point they can no
+       longer be released (see internals_cleanup()). */
+    api = (datetime_api *) malloc(sizeof(datetime_api));
+    if (!api)
+        fail("nanobind::detail::datetime_api_get(): out of memory!");
+    *api = tmp;
+    internals->nb_datetime_api = api;
+
+    return api;
+}
+
+/// Return 'numpy.ndarray' if NumPy has been imported (without importing it)
+static PyTypeObject *numpy_ndarray_tp() {
+    PyTypeObject *tp = internals->numpy_ndarray;
+    if (NB_LIKELY(tp))
+        return tp;
+
+    PyObject *mod = PyDict_GetItemString(PyImport_GetModuleDict(), "numpy");
+    if (!mod)
+        return nullptr;
+
+    // The reference is intentionally leaked (see datetime_api_get())
+    tp = (PyTypeObject *) PyObject_GetAttrString(mod, "ndarray");
+    if (!tp)
+        raise_python_error();
+    if (!PyType_Check((PyObject *) tp)) {
+        Py_DECREF(tp);
+        return nullptr;
+    }
+
+    internals->numpy_ndarray = tp;
+    return tp;
+}
+
+bool load_datetime64(PyObject *o, load_datetime64_cb store,
+                     void *payload) noexcept {
+    try {
+        PyTypeObject *nd = numpy_ndarray_tp();
+        if (!nd || !PyType_IsSubtype(Py_TYPE(o), nd))
+            return false;
+
+        handle h(o);
+        if (!h.attr("dtype").attr("kind").equal(str("M")) ||
+            !h.attr("ndim").equal(int_(1)))
+            return false;
+
+        // Convert the time unit (if needed), then reinterpret as integers
+        object ns = h.attr("astype")("datetime64[ns]", arg("order") = "C",
+                                     arg("copy") = false).attr("view")("int64");
+
+        Py_buffer view;
+        if (PyObject_GetBuffer(ns.ptr(), &view, PyBUF_C_CONTIGUOUS))
+            raise_python_error();
+
+        try {
+            store(payload, (const int64_t *) view.buf,
+                  (size_t) view.len / sizeof(int64_t));
+        } catch (...) {
+            PyBuffer_Release(&view);
+            throw;
+        }
+
+        PyBuffer_Release(&view);
+        return true;
+    } catch (...) {
+        PyErr_Clear();
+        return false;
+    }
+}
+
+PyObject *datetime64_new(size_t size, int64_t **data) {
+    object result = module_::import_("numpy").attr("empty")(
+                        size, "datetime64[ns]"),
+           ns = result.attr("view")("int64");
+
+    // The integer view shares the storage of 'result'
+    Py_buffer view;
+    if (PyObject_GetBuffer(ns.ptr(), &view,
+                           PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS))
+        raise_python_error();
+    *data = (int64_t *) view.buf;
+    PyBuffer_Release(&view);
+
+    return result.release().ptr();
+}
+
+// ========================================================================
+
 void incref_checked(PyObject *o) noexcept {
     if (!o)
         return;
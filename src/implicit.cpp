@@ -24,6 +24,7 @@ void implicitly_convertible(const std::type_info *src,
 
     type_data *t = it->second;
     size_t size = 0;
+    internals->type_epoch++;
 
     if (t->flags & (uint32_t) type_flags::has_implicit_conversions) {
         while (t->implicit && t->implicit[size])
@@ -56,6 +57,7 @@ void implicitly_convertible(bool (*predicate)(PyTypeObject *, PyObject *,
 
     type_data *t = it->second;
     size_t size = 0;
+    internals->type_epoch++;
 
     if (t->flags & (uint32_t) type_flags::has_implicit_conversions) {
         while (t->implicit_py && t->implicit_py[size])
@@ -9,6 +9,7 @@
 
 #include <nanobind/nanobind.h>
 #include "nb_internals.h"
+#include <algorithm>
 
 NAMESPACE_BEGIN(NB_NAMESPACE)
 NAMESPACE_BEGIN(detail)
@@ -20,59 +21,372 @@ NB_INLINE enum_supplement &nb_enum_supplement(PyTypeObject *type) {
 static PyObject *nb_enum_int_signed(PyObject *o);
 static PyObject *nb_enum_int_unsigned(PyObject *o);
 
-/// Map to unique representative enum instance, returns a borrowed reference
-static PyObject *nb_enum_lookup(PyObject *self) {
-    enum_supplement &supp = nb_enum_supplement(Py_TYPE(self));
-    PyObject *int_val = supp.is_signed ? nb_enum_int_signed(self)
-                                       : nb_enum_int_unsigned(self);
-    PyObject *rec = nullptr;
-    if (int_val && supp.entries)
-        rec = (PyObject *) PyDict_GetItem(supp.entries, int_val);
+/**
+ * Lookup table mapping enum values onto their (name, doc, instance) entry
+ * tuples, which are owned by the 'supp.entries' dictionary. Values are
+ * represented by order-preserving unsigned keys. Contiguous enumerations use
+ * a dense array indexed by 'key - min_key' (with 'rec == nullptr' for any
+ * gaps), others store the entries sorted by key for binary search.
+ */
+struct enum_table {
+    struct entry {
+        uint64_t key;
+        PyObject *rec;
+    };
+
+    bool dense;
+    uint64_t min_key;
+    uint64_t mask; // Union of the raw bits of all entries
+    size_t size;
+    entry entries[1];
+};
+
+/// Map the value of an enum instance onto an order-preserving unsigned key
+static bool nb_enum_key(const void *p, size_t size, bool is_signed,
+                        uint64_t *key) noexcept {
+    if (is_signed) {
+        int64_t value;
+        switch (size) {
+            case 1: value = *(const int8_t *)  p; break;
+            case 2: value = *(const int16_t *) p; break;
+            case 4: value = *(const int32_t *) p; break;
+            case 8: value = *(const int64_t *) p; break;
+            default: return false;
+        }
+        *key = (uint64_t) value ^ ((uint64_t) 1 << 63);
+    } else {
+        switch (size) {
+            case 1: *key = *(const uint8_t *)  p; break;
+            case 2: *key = *(const uint16_t *) p; break;
+            case 4: *key = *(const uint32_t *) p; break;
+            case 8: *key = *(const uint64_t *) p; break;
+            default: return false;
+        }
+    }
+    return true;
+}
+
+/// Read the value of an enum instance as raw bits
+static uint64_t nb_enum_bits(const void *p, size_t size) noexcept {
+    switch (size) {
+        case 1: return *(const uint8_t *)  p;
+        case 2: return *(const uint16_t *) p;
+        case 4: return *(const uint32_t *) p;
+        default: return *(const uint64_t *) p;
+    }
+}
+
+static enum_table *nb_enum_table_build(PyTypeObject *tp,
+                                       enum_supplement &supp) noexcept {
+    PyObject *dicts[2] = { supp.entries, supp.composites };
+    size_t size = 0;
+    for (PyObject *dict : dicts)
+        size += dict ? (size_t) PyDict_Size(dict) : 0;
+    if (size == 0)
+        return nullptr;
+
+    size_t type_size = nb_type_data(tp)->size;
+
+    scoped_pymalloc<enum_table::entry> sorted(size);
+    size_t n = 0;
+    uint64_t mask = 0;
+
+    for (PyObject *dict : dicts) {
+        PyObject *key, *value;
+        Py_ssize_t pos = 0;
+
+        while (dict && PyDict_Next(dict, &pos, &key, &value)) {
+            if (!PyTuple_CheckExact(value) || NB_TUPLE_GET_SIZE(value) != 3)
+                return nullptr;
+            const void *p = inst_ptr((nb_inst *) NB_TUPLE_GET_ITEM(value, 2));
+            if (!nb_enum_key(p, type_size, supp.is_signed, &sorted[n].key))
+                return nullptr;
+            // Composites only consist of bits of named entries
+            if (dict == supp.entries)
+                mask |= nb_enum_bits(p, type_size);
+            sorted[n++].rec = value;
+        }
+    }
+
+    std::sort(sorted.get(), sorted.get() + n,
+              [](const enum_table::entry &a, const enum_table::entry &b) {
+                  return a.key < b.key;
+              });
 
-    Py_XDECREF(int_val);
+    // Use a dense array unless it would be more than half empty
+    uint64_t min_key = sorted[0].key,
+             range = sorted[n - 1].key - min_key;
+    bool dense = range < 2 * (uint64_t) n;
+    size_t table_size = dense ? (size_t) range + 1 : n;
 
-    if (rec && PyTuple_CheckExact(rec) && NB_TUPLE_GET_SIZE(rec) == 3) {
-        return rec;
+    enum_table *table = (enum_table *) calloc(
+        1, sizeof(enum_table) + (table_size - 1) * sizeof(enum_table::entry));
+    if (!table)
+        return nullptr;
+
+    table->dense = dense;
+    table->min_key = min_key;
+    table->mask = mask;
+    table->size = table_size;
+
+    if (dense) {
+        for (size_t i = 0; i < n; ++i)
+            table->entries[sorted[i].key - min_key] = sorted[i];
     } else {
-        PyErr_Clear();
-        PyErr_SetString(PyExc_RuntimeError, "nb_enum: could not find entry!");
+        memcpy(table->entries, sorted.get(), n * sizeof(enum_table::entry));
+    }
+
+    supp.table = table;
+    return table;
+}
+
+static enum_table *nb_enum_table(PyTypeObject *tp) noexcept {
+    enum_supplement &supp = nb_enum_supplement(tp);
+    enum_table *table = supp.table;
+    if (NB_UNLIKELY(!table))
+        table = nb_enum_table_build(tp, supp);
+    return table;
+}
+
+/// Find the entry tuple of the given key, returns a borrowed reference
+static PyObject *nb_enum_find(PyTypeObject *tp, uint64_t key) noexcept {
+    enum_table *table = nb_enum_table(tp);
+    if (!table)
         return nullptr;
+
+    if (table->dense) {
+        uint64_t index = key - table->min_key;
+        return index < table->size ? table->entries[index].rec : nullptr;
+    }
+
+    size_t lo = 0, hi = table->size;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        uint64_t mid_key = table->entries[mid].key;
+        if (mid_key == key)
+            return table->entries[mid].rec;
+        else if (mid_key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
+
+    return nullptr;
 }
 
-static PyObject *nb_enum_repr(PyObject *self) {
-    PyObject *entry = nb_enum_lookup(self);
-    if (!entry)
+
+/// Store raw bits (truncated to the size of the enum) into an enum value
+static void nb_enum_set_bits(void *p, size_t size, uint64_t bits) noexcept {
+    switch (size) {
+        case 1: *(uint8_t *)  p = (uint8_t)  bits; break;
+        case 2: *(uint16_t *) p = (uint16_t) bits; break;
+        case 4: *(uint32_t *) p = (uint32_t) bits; break;
+        default: *(uint64_t *) p = bits; break;
+    }
+}
+
+/// Name of an unnamed flag value, e.g. "Read|Write" or "Read|0x100"
+static PyObject *nb_enum_flag_name(PyTypeObject *tp, uint64_t bits) {
+    enum_supplement &supp = nb_enum_supplement(tp);
+    size_t type_size = nb_type_data(tp)->size;
+    uint64_t remainder = bits;
+
+    // Collect the named single-bit entries contained in 'bits'
+    PyObject *names[64] { };
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+
+    while (supp.entries && PyDict_Next(supp.entries, &pos, &key, &value)) {
+        uint64_t entry = nb_enum_bits(
+            inst_ptr((nb_inst *) NB_TUPLE_GET_ITEM(value, 2)), type_size);
+        if (entry == 0 || (entry & (entry - 1)) != 0 || (entry & bits) == 0)
+            continue;
+
+        int index = 0;
+        while (!((entry >> index) & 1))
+            ++index;
+        names[index] = NB_TUPLE_GET_ITEM(value, 0);
+        remainder &= ~entry;
+    }
+
+    object result = steal(PyList_New(0));
+    for (PyObject *name : names) {
+        if (name && PyList_Append(result.ptr(), name))
+            return nullptr;
+    }
+
+    if (remainder || bits == 0) {
+        char buf[19];
+        snprintf(buf, sizeof(buf), "0x%llx", (unsigned long long) remainder);
+        object rest = steal(PyUnicode_FromString(buf));
+        if (!rest.is_valid() || PyList_Append(result.ptr(), rest.ptr()))
+            return nullptr;
+    }
+
+    object sep = steal(PyUnicode_InternFromString("|"));
+    if (!sep.is_valid())
         return nullptr;
 
-    PyObject *name = nb_inst_name(self);
-    PyObject *result =
-        PyUnicode_FromFormat("%U.%U", name, NB_TUPLE_GET_ITEM(entry, 0));
-    Py_DECREF(name);
+    return PyUnicode_Join(sep.ptr(), result.ptr());
+}
 
-    return result;
+/// Maximum number of unnamed flag values that are cached per enumeration
+static constexpr Py_ssize_t nb_enum_max_composites = 64;
+
+/**
+ * Create an instance representing an unnamed value of a flag enum. Values
+ * that only consist of bits of named entries are cached in 'supp.composites'
+ * (up to 'nb_enum_max_composites' of them) and then served from the lookup
+ * table. Other values produce a new instance each time, whose name is
+ * computed on demand by nb_enum_field(). Returns a new reference.
+ */
+static PyObject *nb_enum_composite(PyTypeObject *tp, uint64_t bits) noexcept {
+    enum_supplement &supp = nb_enum_supplement(tp);
+    enum_table *table = nb_enum_table(tp);
+
+    nb_inst *inst = (nb_inst *) inst_new_int(tp);
+    if (!inst)
+        return nullptr;
+
+    nb_enum_set_bits(inst_ptr(inst), nb_type_data(tp)->size, bits);
+    inst->destruct = false;
+    inst->cpp_delete = false;
+    inst->ready = true;
+
+    if (!table || (bits & ~table->mask) != 0 ||
+        (supp.composites &&
+         PyDict_Size(supp.composites) >= nb_enum_max_composites))
+        return (PyObject *) inst;
+
+    object name = steal(nb_enum_flag_name(tp, bits)),
+           int_val = steal(supp.is_signed
+                               ? nb_enum_int_signed((PyObject *) inst)
+                               : nb_enum_int_unsigned((PyObject *) inst)),
+           rec = steal(PyTuple_New(3));
+
+    if (!name.is_valid() || !int_val.is_valid() || !rec.is_valid()) {
+        Py_DECREF(inst);
+        return nullptr;
+    }
+
+    Py_INCREF(Py_None);
+    Py_INCREF(inst);
+    NB_TUPLE_SET_ITEM(rec.ptr(), 0, name.release().ptr());
+    NB_TUPLE_SET_ITEM(rec.ptr(), 1, Py_None);
+    NB_TUPLE_SET_ITEM(rec.ptr(), 2, (PyObject *) inst);
+
+    if (!supp.composites) {
+        PyObject *dict = PyDict_New();
+
+        // Stashed in the type object like '@entries' so that GC can see it
+        if (!dict ||
+            PyObject_SetAttrString((PyObject *) tp, "@composites", dict)) {
+            Py_XDECREF(dict);
+            Py_DECREF(inst);
+            return nullptr;
+        }
+
+        supp.composites = dict;
+        Py_DECREF(dict);
+    }
+
+    if (PyDict_SetItem(supp.composites, int_val.ptr(), rec.ptr())) {
+        Py_DECREF(inst);
+        return nullptr;
+    }
+
+    // Rebuild the lookup table on demand
+    free(supp.table);
+    supp.table = nullptr;
+
+    return (PyObject *) inst;
 }
 
-static PyObject *nb_enum_get_name(PyObject *self, void *) {
-    PyObject *entry = nb_enum_lookup(self);
-    if (!entry)
+/// Return the instance representing 'bits' (new reference), or nullptr
+static PyObject *nb_enum_from_bits(PyTypeObject *tp, uint64_t bits) noexcept {
+    enum_supplement &supp = nb_enum_supplement(tp);
+    size_t type_size = nb_type_data(tp)->size;
+
+    uint64_t storage = 0, key;
+    nb_enum_set_bits(&storage, type_size, bits);
+    if (!nb_enum_key(&storage, type_size, supp.is_signed, &key))
         return nullptr;
 
-    PyObject *result = NB_TUPLE_GET_ITEM(entry, 0);
-    Py_INCREF(result);
+    PyObject *rec = nb_enum_find(tp, key);
+    if (rec) {
+        PyObject *result = NB_TUPLE_GET_ITEM(rec, 2);
+        Py_INCREF(result);
+        return result;
+    } else if (supp.is_flag) {
+        return nb_enum_composite(tp, nb_enum_bits(&storage, type_size));
+    } else {
+        return nullptr;
+    }
+}
+
+/// Return the instance representing an enum value (new reference), or nullptr
+PyObject *nb_enum_get(PyTypeObject *tp, const void *value) noexcept {
+    PyObject *result =
+        nb_enum_from_bits(tp, nb_enum_bits(value, nb_type_data(tp)->size));
+    if (!result)
+        PyErr_Clear();
     return result;
 }
 
-static PyObject *nb_enum_get_doc(PyObject *self, void *) {
-    PyObject *entry = nb_enum_lookup(self);
-    if (!entry)
+void nb_enum_table_free(PyTypeObject *tp) noexcept {
+    enum_supplement &supp = nb_enum_supplement(tp);
+    free(supp.table);
+    supp.table = nullptr;
+}
+
+/// Return the name (index 0) or docstring (index 1) of an enum instance
+static PyObject *nb_enum_field(PyObject *self, size_t index) {
+    PyTypeObject *tp = Py_TYPE(self);
+    enum_supplement &supp = nb_enum_supplement(tp);
+    size_t type_size = nb_type_data(tp)->size;
+    const void *p = inst_ptr((nb_inst *) self);
+    uint64_t key;
+    PyObject *rec = nullptr;
+
+    if (nb_enum_key(p, type_size, supp.is_signed, &key))
+        rec = nb_enum_find(tp, key);
+
+    if (rec) {
+        PyObject *result = NB_TUPLE_GET_ITEM(rec, index);
+        Py_INCREF(result);
+        return result;
+    } else if (supp.is_flag) {
+        // Unnamed value of a flag enum
+        if (index == 0)
+            return nb_enum_flag_name(tp, nb_enum_bits(p, type_size));
+        Py_RETURN_NONE;
+    }
+
+    PyErr_SetString(PyExc_RuntimeError, "nb_enum: could not find entry!");
+    return nullptr;
+}
+
+static PyObject *nb_enum_repr(PyObject *self) {
+    PyObject *entry_name = nb_enum_field(self, 0);
+    if (!entry_name)
         return nullptr;
 
-    PyObject *result = NB_TUPLE_GET_ITEM(entry, 1);
-    Py_INCREF(result);
+    PyObject *name = nb_inst_name(self);
+    PyObject *result = PyUnicode_FromFormat("%U.%U", name, entry_name);
+    Py_DECREF(name);
+    Py_DECREF(entry_name);
+
     return result;
 }
 
+static PyObject *nb_enum_get_name(PyObject *self, void *) {
+    return nb_enum_field(self, 0);
+}
+
+static PyObject *nb_enum_get_doc(PyObject *self, void *) {
+    return nb_enum_field(self, 1);
+}
+
 NB_NOINLINE static PyObject *nb_enum_int_signed(PyObject *o) {
     type_data *t = nb_type_data(Py_TYPE(o));
     const void *p = inst_ptr((nb_inst *) o);
@@ -116,15 +430,43 @@ static PyObject *nb_enum_new(PyTypeObject *subtype, PyObject *args, PyObject *kw
     arg = NB_TUPLE_GET_ITEM(args, 0);
     if (PyLong_Check(arg)) {
         enum_supplement &supp = nb_enum_supplement(subtype);
-        if (!supp.entries)
-            goto error;
+        size_t size = nb_type_data(subtype)->size;
+        uint64_t key;
+
+        // Values that do not fit into the underlying type fail below
+        if (supp.is_signed) {
+            long long value = PyLong_AsLongLong(arg);
+            if (value == -1 && PyErr_Occurred())
+                goto error;
+            if (size < 8 && (value < -(1ll << (size * 8 - 1)) ||
+                             value >= (1ll << (size * 8 - 1))))
+                goto error;
+            key = (uint64_t) value ^ ((uint64_t) 1 << 63);
+        } else {
+            unsigned long long value = PyLong_AsUnsignedLongLong(arg);
+            if (value == (unsigned long long) -1 && PyErr_Occurred())
+                goto error;
+            if (size < 8 && value >= (1ull << (size * 8)))
+                goto error;
+            key = (uint64_t) value;
+        }
 
-        PyObject *item = PyDict_GetItem(supp.entries, arg);
-        if (item && PyTuple_CheckExact(item) && NB_TUPLE_GET_SIZE(item) == 3) {
-            item = NB_TUPLE_GET_ITEM(item, 2);
-            Py_INCREF(item);
-            return item;
+        // Flag enums also accept unnamed values
+        PyObject *item = nullptr;
+        if (supp.is_flag) {
+            item = nb_enum_from_bits(subtype, supp.is_signed
+                                                  ? key ^ ((uint64_t) 1 << 63)
+                                                  : key);
+        } else {
+            PyObject *rec = nb_enum_find(subtype, key);
+            if (rec) {
+                item = NB_TUPLE_GET_ITEM(rec, 2);
+                Py_INCREF(item);
+            }
         }
+
+        if (item)
+            return item;
     } else if (Py_TYPE(arg) == subtype) {
         Py_INCREF(arg);
         return arg;
@@ -263,6 +605,66 @@ NB_ENUM_UNOP(neg, PyNumber_Negative)
 NB_ENUM_UNOP(inv, PyNumber_Invert)
 NB_ENUM_UNOP(abs, PyNumber_Absolute)
 
+// Bitwise operators of flag enums combine the values of two instances of
+// the same type and return an instance of that type. Other operands are
+// only supported by arithmetic enums, which convert them to integers.
+NB_NOINLINE static PyObject *nb_enum_flag_binop(PyObject *a, PyObject *b,
+                                                char op) {
+    PyTypeObject *tp = Py_TYPE(a);
+
+    if (tp != Py_TYPE(b)) {
+        PyTypeObject *tp_b = Py_TYPE(b);
+        bool a_is_flag = nb_type_check((PyObject *) tp) &&
+                         (nb_type_data(tp)->flags & (uint32_t) type_flags::is_enum) &&
+                         nb_enum_supplement(tp).is_flag;
+        if (!nb_enum_supplement(a_is_flag ? tp : tp_b).is_arithmetic)
+            Py_RETURN_NOTIMPLEMENTED;
+
+        switch (op) {
+            case '|': return nb_enum_binop(a, b, PyNumber_Or);
+            case '&': return nb_enum_binop(a, b, PyNumber_And);
+            default:  return nb_enum_binop(a, b, PyNumber_Xor);
+        }
+    }
+
+    size_t size = nb_type_data(tp)->size;
+    uint64_t va = nb_enum_bits(inst_ptr((nb_inst *) a), size),
+             vb = nb_enum_bits(inst_ptr((nb_inst *) b), size), result;
+
+    switch (op) {
+        case '|': result = va | vb; break;
+        case '&': result = va & vb; break;
+        default:  result = va ^ vb; break;
+    }
+
+    return nb_enum_from_bits(tp, result);
+}
+
+static PyObject *nb_enum_flag_or(PyObject *a, PyObject *b) {
+    return nb_enum_flag_binop(a, b, '|');
+}
+
+static PyObject *nb_enum_flag_and(PyObject *a, PyObject *b) {
+    return nb_enum_flag_binop(a, b, '&');
+}
+
+static PyObject *nb_enum_flag_xor(PyObject *a, PyObject *b) {
+    return nb_enum_flag_binop(a, b, '^');
+}
+
+// Like enum.Flag, the complement only contains bits of defined entries
+static PyObject *nb_enum_flag_inv(PyObject *a) {
+    PyTypeObject *tp = Py_TYPE(a);
+    uint64_t value = nb_enum_bits(inst_ptr((nb_inst *) a), nb_type_data(tp)->size);
+    enum_table *table = nb_enum_table(tp);
+    return nb_enum_from_bits(tp, ~value & (table ? table->mask : 0));
+}
+
+static int nb_enum_flag_bool(PyObject *a) {
+    return nb_enum_bits(inst_ptr((nb_inst *) a),
+                        nb_type_data(Py_TYPE(a))->size) != 0;
+}
+
 int nb_enum_clear(PyObject *) {
     return 0;
 }
@@ -295,9 +697,9 @@ Py_hash_t nb_enum_hash(PyObject *o) {
 
 void nb_enum_prepare(const type_init_data *td,
                      PyType_Slot *&t, size_t max_slots) noexcept {
-    /* 22 is the number of slot assignments below. Update it if you add more.
-       These built-in slots are added before any user-defined ones. */
-    check(max_slots >= 22,
+    /* 23 is the maximal number of slot assignments below. Update it if you
+       add more. These built-in slots are added before any user-defined ones. */
+    check(max_slots >= 23,
           "nanobind::detail::nb_enum_prepare(\"%s\"): ran out of "
           "type slots!", td->name);
 
@@ -315,18 +717,28 @@ void nb_enum_prepare(const type_init_data *td,
     *t++ = { Py_tp_clear, (void *) nb_enum_clear };
     *t++ = { Py_tp_hash, (void *) nb_enum_hash };
 
+    if (ed->is_flag) {
+        *t++ = { Py_nb_or, (void *) nb_enum_flag_or };
+        *t++ = { Py_nb_xor, (void *) nb_enum_flag_xor };
+        *t++ = { Py_nb_and, (void *) nb_enum_flag_and };
+        *t++ = { Py_nb_invert, (void *) nb_enum_flag_inv };
+        *t++ = { Py_nb_bool, (void *) nb_enum_flag_bool };
+    }
+
     if (ed->is_arithmetic) {
         *t++ = { Py_nb_add, (void *) nb_enum_add };
         *t++ = { Py_nb_subtract, (void *) nb_enum_sub };
         *t++ = { Py_nb_multiply, (void *) nb_enum_mul };
         *t++ = { Py_nb_floor_divide, (void *) nb_enum_div };
-        *t++ = { Py_nb_or, (void *) nb_enum_or };
-        *t++ = { Py_nb_xor, (void *) nb_enum_xor };
-        *t++ = { Py_nb_and, (void *) nb_enum_and };
+        if (!ed->is_flag) {
+            *t++ = { Py_nb_or, (void *) nb_enum_or };
+            *t++ = { Py_nb_xor, (void *) nb_enum_xor };
+            *t++ = { Py_nb_and, (void *) nb_enum_and };
+            *t++ = { Py_nb_invert, (void *) nb_enum_inv };
+        }
         *t++ = { Py_nb_rshift, (void *) nb_enum_rshift };
         *t++ = { Py_nb_lshift, (void *) nb_enum_lshift };
         *t++ = { Py_nb_negative, (void *) nb_enum_neg };
-        *t++ = { Py_nb_invert, (void *) nb_enum_inv };
         *t++ = { Py_nb_absolute, (void *) nb_enum_abs };
     }
 }
@@ -386,6 +798,15 @@ void nb_enum_put(PyObject *type, const char *name, const void *value,
     if (PyDict_SetItem(supp.entries, int_val, rec))
         goto error;
 
+    // A cached unnamed flag value may now have a name
+    if (supp.composites && PyDict_Contains(supp.composites, int_val) == 1 &&
+        PyDict_DelItem(supp.composites, int_val))
+        goto error;
+
+    // Rebuild the lookup table on demand
+    free(supp.table);
+    supp.table = nullptr;
+
     Py_DECREF(int_val);
     Py_DECREF(rec);
 
@@ -210,8 +210,17 @@ PyObject *nb_func_new(const void *in_) noexcept {
 
                 /* Never append a method to an overload chain of a parent class;
                    instead, hide the parent's overloads in this case */
-                if (fp->scope != f->scope)
+                if (fp->scope != f->scope) {
                     Py_CLEAR(func_prev);
+                } else {
+                    /* std::function<..> callbacks capture the entry point of
+                       nb::direct() functions, which must not be relocated */
+                    check(!((fp->flags | f->flags) &
+                            (uint32_t) func_flags::has_direct),
+                          "nb::detail::nb_func_new(\"%s\"): functions "
+                          "annotated with nb::direct() cannot be overloaded!",
+                          f->name);
+                }
             } else if (f->name[0] == '_') {
                 Py_CLEAR(func_prev);
             } else {
@@ -451,6 +460,38 @@ static NB_NOINLINE void nb_func_convert_cpp_exception() noexcept {
                     "could not be translated!");
 }
 
+/// Used by native slot implementations, e.g. the tp_iternext of make_iterator()
+void nb_func_set_error() noexcept {
+    try {
+        throw;
+    } catch (builtin_exception &e) {
+        if (!set_builtin_exception_status(e))
+            PyErr_SetString(PyExc_SystemError,
+                            "nanobind::detail::nb_func_set_error(): "
+                            "next_overload is not supported here!");
+    } catch (python_error &e) {
+        e.restore();
+    } catch (...) {
+        nb_func_convert_cpp_exception();
+    }
+}
+
+/// Used by the std::function<..> caster to bypass the Python calling convention
+bool nb_func_get_direct(PyObject *o, const std::type_info *type,
+                        void (**direct)(), size_t *offset) noexcept {
+    if (Py_TYPE(o) != internals->nb_func || Py_SIZE(o) != 1)
+        return false;
+
+    func_data *f = nb_func_data(o);
+    if (!(f->flags & (uint32_t) func_flags::has_direct) ||
+        !(*f->direct_type == *type))
+        return false;
+
+    *direct = f->direct;
+    *offset = (size_t) ((char *) f->capture - (char *) o);
+    return true;
+}
+
 /// Dispatch loop that is used to invoke functions created by nb_func_new
 static PyObject *nb_func_vectorcall_complex(PyObject *self,
                                             PyObject *const *args_in,
@@ -468,6 +509,9 @@ static PyObject *nb_func_vectorcall_complex(PyObject *self,
     PyObject *result = nullptr,
              *self_arg = (is_method && nargs_in > 0) ? args_in[0] : nullptr;
 
+    // Release references that other threads dropped without holding the GIL
+    dec_ref_drain_pending();
+
     /* The following lines allocate memory on the stack, which is very efficient
        but also potentially dangerous since it can be used to generate stack
        overflows. We refuse unrealistically large number of 'kwargs' (the
@@ -702,6 +746,9 @@ static PyObject *nb_func_vectorcall_simple(PyObject *self,
     PyObject *result = nullptr,
              *self_arg = (is_method && nargs_in > 0) ? args_in[0] : nullptr;
 
+    // Release references that other threads dropped without holding the GIL
+    dec_ref_drain_pending();
+
     // Small array holding temporaries (implicit conversion/*args/**kwargs)
     cleanup_list cleanup(self_arg);
 
@@ -850,12 +897,29 @@ static void nb_func_render_signature(const func_data *f) noexcept {
     uint32_t arg_index = 0;
     buf.put_dstr(f->name);
 
+    /* Names created by io_name() have the form '@input@output@'. Only the
+       first part is shown in arguments, and only the second one otherwise */
+    bool in_arg = false;
+    int io_part = 0;
+
     for (const char *pc = f->descr; *pc != '\0'; ++pc) {
         char c = *pc;
 
+        if (c == '@') {
+            io_part = (io_part + 1) % 3;
+            continue;
+        }
+
+        if (io_part != 0 && (io_part == 1) != in_arg) {
+            if (c == '%')
+                descr_type++;
+            continue;
+        }
+
         switch (c) {
             case '{':
                 {
+                    in_arg = true;
                     const char *arg_name = has_args ? f->args[arg_index].name : nullptr;
 
                     // Argument name
@@ -883,6 +947,7 @@ static void nb_func_render_signature(const func_data *f) noexcept {
                             pc++;
                         }
                         arg_index++;
+                        in_arg = false;
                         continue;
                     } else if (arg_name) {
                         buf.put_dstr(arg_name);
@@ -899,6 +964,8 @@ static void nb_func_render_signature(const func_data *f) noexcept {
                 break;
 
             case '}':
+                in_arg = false;
+
                 // Default argument
                 if (has_args) {
                     if (f->args[arg_index].none)
@@ -17,7 +17,7 @@
 
 /// Tracks the ABI of nanobind
 #ifndef NB_INTERNALS_VERSION
-#  define NB_INTERNALS_VERSION 11
+#  define NB_INTERNALS_VERSION 12
 #endif
 
 /// On MSVC, debug and release builds are not ABI-compatible!
@@ -224,12 +224,90 @@ static bool is_alive_value = false;
 static bool *is_alive_ptr = &is_alive_value;
 bool is_alive() noexcept { return *is_alive_ptr; }
 
+void dec_ref_drain() noexcept {
+    nb_internals *int_p = internals;
+    int_p->decref_scheduled.store(false);
+
+    decref_node *n = int_p->decref_queue.exchange(nullptr);
+    while (n) {
+        decref_node *next = n->next;
+        Py_DECREF(n->o);
+        free(n);
+        n = next;
+    }
+}
+
+#if !defined(Py_LIMITED_API) && !defined(PYPY_VERSION)
+static int dec_ref_pending_call(void *) {
+    dec_ref_drain();
+    return 0;
+}
+#endif
+
+void dec_ref_deferred(PyObject *o) noexcept {
+    /* After internals_cleanup() has run, the queue no longer exists and the
+       reference can't be released anymore */
+    if (!is_alive())
+        return;
+
+#if defined(Py_LIMITED_API)
+    // Cannot determine whether the GIL is held, acquire it just in case
+    PyGILState_STATE state = PyGILState_Ensure();
+    Py_DECREF(o);
+    PyGILState_Release(state);
+#else
+    if (PyGILState_Check()) {
+        Py_DECREF(o);
+        return;
+    }
+
+    /* Push onto a lock-free stack instead of blocking on the GIL. The queue is
+       drained by the next call of a bound function, or by a pending call that
+       the interpreter runs at its next opportunity. */
+    decref_node *n = (decref_node *) malloc(sizeof(decref_node));
+    if (!n)
+        fail("nanobind::detail::dec_ref_deferred(): out of memory!");
+    n->o = o;
+
+    nb_internals *int_p = internals;
+    n->next = int_p->decref_queue.load(std::memory_order_relaxed);
+    while (!int_p->decref_queue.compare_exchange_weak(n->next, n))
+        ;
+
+#if !defined(PYPY_VERSION)
+    if (!int_p->decref_scheduled.exchange(true) &&
+        Py_AddPendingCall(dec_ref_pending_call, nullptr) != 0)
+        int_p->decref_scheduled.store(false);
+#endif
+#endif
+}
+
 static void internals_cleanup() {
     if (!internals)
         return;
 
     *is_alive_ptr = false;
 
+    if (internals->nb_ndarray_pool) {
+        ndarray_pool_shutdown(internals->nb_ndarray_pool);
+        internals->nb_ndarray_pool = nullptr;
+    }
+
+    // The interpreter is gone at this point, only release the table itself
+    free(internals->nb_str_cache);
+    internals->nb_str_cache = nullptr;
+    free(internals->nb_datetime_api);
+    internals->nb_datetime_api = nullptr;
+    internals->numpy_ndarray = nullptr;
+    internals->override_names = nullptr;
+
+    decref_node *n = internals->decref_queue.exchange(nullptr);
+    while (n) {
+        decref_node *next = n->next;
+        free(n);
+        n = next;
+    }
+
 #if !defined(PYPY_VERSION)
     /* The memory leak checker is unsupported on PyPy, see
        see https://foss.heptapod.net/pypy/pypy/-/issues/3855 */
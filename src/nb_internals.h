@@ -13,6 +13,7 @@
 
 #include <nanobind/nanobind.h>
 #include <tsl/robin_map.h>
+#include <atomic>
 #include <typeindex>
 #include <cstring>
 
@@ -70,7 +71,8 @@ struct nb_inst { // usually: 24 bytes
     /// Does this instance use intrusive reference counting?
     uint32_t intrusive : 1;
 
-    uint32_t unused: 25;
+    /// Number of active buffer protocol exports (e.g. of bound vectors)
+    uint32_t exports : 25;
 };
 
 static_assert(sizeof(nb_inst) == sizeof(PyObject) + sizeof(uint32_t) * 2);
@@ -89,6 +91,16 @@ struct nb_ndarray {
     ndarray_handle *th;
 };
 
+/// Python object exposing memory owned by a C++ object via the buffer protocol
+struct nb_buffer {
+    PyObject_HEAD
+    void *data;
+    Py_ssize_t size;
+    bool readonly;
+    void *payload;
+    void (*deleter)(void *) noexcept;
+};
+
 /// Python object representing an `nb_method` bound to an instance (analogous to non-public PyMethod_Type)
 struct nb_bound_method {
     PyObject_HEAD
@@ -175,6 +187,27 @@ NB_INLINE void*        nb_mark_seq(void *p) { return (void *) (((uintptr_t) p) |
 /// Retrieve the nb_inst_seq* pointer from an 'inst_c2p' value
 NB_INLINE nb_inst_seq* nb_get_seq(void *p)  { return (nb_inst_seq *) (((uintptr_t) p) ^ 1); }
 
+/// Size-class pool backing nb::ndarray<..>::empty() and zeros()
+struct ndarray_pool;
+
+/// Interning cache for short strings returned by the std::string[_view] casters
+struct str_cache {
+    struct entry {
+        PyObject *str;
+        size_t hash;
+    };
+
+    size_t max_length;
+    size_t mask;
+    entry entries[1];
+};
+
+/// Entry of the queue of references released by dec_ref_deferred()
+struct decref_node {
+    decref_node *next;
+    PyObject *o;
+};
+
 struct nb_translator_seq {
     exception_translator translator;
     void *payload;
@@ -202,6 +235,27 @@ struct nb_internals {
     /// N-dimensional array wrapper (created on demand)
     PyTypeObject *nb_ndarray = nullptr;
 
+    /// Owner of memory returned via nb::owned_buffer<..> (created on demand)
+    PyTypeObject *nb_buffer = nullptr;
+
+    /// Storage pool for nb::ndarray<..>::empty() and zeros() (created on demand)
+    ndarray_pool *nb_ndarray_pool = nullptr;
+
+    /// Short string interning cache (created by nb::set_string_interning())
+    str_cache *nb_str_cache = nullptr;
+
+    /// Objects of the 'datetime' module (created on demand)
+    datetime_api *nb_datetime_api = nullptr;
+
+    /// The 'numpy.ndarray' type, once NumPy has been imported (looked up on demand)
+    PyTypeObject *numpy_ndarray = nullptr;
+
+    /// References released by threads that did not hold the GIL
+    std::atomic<decref_node *> decref_queue{nullptr};
+
+    /// Was a pending call scheduled to process 'decref_queue'?
+    std::atomic<bool> decref_scheduled{false};
+
     /**
      * C++ -> Python instance map
      *
@@ -236,6 +290,18 @@ struct nb_internals {
     /// Pointer to a boolean that denotes if nanobind is fully initialized.
     bool *is_alive_ptr = nullptr;
 
+    /// Number of types with trampoline override tables
+    size_t override_tables = 0;
+
+    /// Advanced when types are destroyed or gain implicit conversions
+    size_t type_epoch = 0;
+
+    /// Interned names of virtual functions that trampolines looked up
+    PyObject *override_names = nullptr;
+
+    /// Advanced when attributes of bound types change, see 'override_table'
+    std::atomic<size_t> override_epoch{0};
+
 #if defined(Py_LIMITED_API)
     // Cache important functions from PyType_Type and PyProperty_Type
     freefunc PyType_Type_tp_free;
@@ -263,6 +329,18 @@ extern char *type_name(const std::type_info *t);
 extern PyObject *inst_new_ext(PyTypeObject *tp, void *value);
 extern PyObject *inst_new_int(PyTypeObject *tp);
 extern PyTypeObject *nb_static_property_tp() noexcept;
+extern void ndarray_pool_shutdown(ndarray_pool *pool) noexcept;
+extern PyObject *nb_enum_get(PyTypeObject *tp, const void *value) noexcept;
+extern void nb_enum_table_free(PyTypeObject *tp) noexcept;
+extern void override_table_free(override_table *t) noexcept;
+extern void override_invalidate(PyTypeObject *tp, PyObject *name) noexcept;
+extern void dec_ref_drain() noexcept;
+
+/// Release references queued by other threads, requires the GIL
+NB_INLINE void dec_ref_drain_pending() noexcept {
+    if (NB_UNLIKELY(internals->decref_queue.load(std::memory_order_relaxed)))
+        dec_ref_drain();
+}
 
 /// Fetch the nanobind function record from a 'nb_func' instance
 NB_INLINE func_data *nb_func_data(void *o) {
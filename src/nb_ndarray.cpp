@@ -1,7 +1,23 @@
 #include <nanobind/ndarray.h>
 #include <atomic>
+#include <mutex>
 #include "nb_internals.h"
 
+#if defined(_WIN32)
+#  if !defined(WIN32_LEAN_AND_MEAN)
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  if !defined(NOMINMAX)
+#    define NOMINMAX
+#  endif
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <fcntl.h>
+#  include <unistd.h>
+#endif
+
 NAMESPACE_BEGIN(NB_NAMESPACE)
 NAMESPACE_BEGIN(detail)
 
@@ -17,12 +33,166 @@ struct ndarray_handle {
     managed_dltensor *ndarray;
     std::atomic<size_t> refcount;
     PyObject *owner, *self;
+    ndarray_pool *pool; // Pool that provided 'storage' (via ndarray_alloc())
+    void *storage;
+    size_t storage_size;
+    void *mapping; // File mapping (via ndarray_map_file()), if any
+    size_t mapping_size;
+    ndarray_handle *parent; // Array whose storage is shared by this view
     bool free_shape;
     bool free_strides;
     bool call_deleter;
     bool ro;
 };
 
+// ========================================================================
+
+/* Storage for ndarray_alloc() is recycled through a size-class pool with one
+   free list per power of two. It is shared by all extension modules of a
+   domain. Blocks are 64-byte aligned, or aligned to the huge page size if they
+   are large enough to benefit from huge pages. Buffers may be released by
+   threads that don't hold the GIL, hence the mutex. */
+
+static constexpr size_t pool_min_shift = 6,   // 64 B
+                        pool_max_shift = 27,  // 128 MiB
+                        pool_max_cached = (size_t) 256 << 20,
+                        huge_page_size = (size_t) 2 << 20;
+
+struct pool_block { pool_block *next; };
+
+struct ndarray_pool {
+    std::mutex mutex;
+    pool_block *free_list[pool_max_shift + 1] { };
+    size_t cached = 0; // Number of bytes held in the free lists
+    size_t live = 0;   // Number of blocks currently used by ndarrays
+    bool alive = true; // Set to 'false' following interpreter shutdown
+};
+
+static void *pool_aligned_alloc(size_t size) {
+    size_t align = size >= huge_page_size ? huge_page_size : 64;
+#if defined(_WIN32)
+    return _aligned_malloc(size, align);
+#else
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, align, size))
+        ptr = nullptr;
+    return ptr;
+#endif
+}
+
+static void pool_aligned_free(void *ptr) {
+#if defined(_WIN32)
+    _aligned_free(ptr);
+#else
+    free(ptr);
+#endif
+}
+
+/// Round 'size' up to the block size of its size class
+static size_t pool_block_size(size_t size) {
+    size_t shift = pool_min_shift;
+    while (shift <= pool_max_shift && ((size_t) 1 << shift) < size)
+        shift++;
+    return shift <= pool_max_shift ? ((size_t) 1 << shift) : size;
+}
+
+static size_t pool_class(size_t block_size) {
+    size_t shift = pool_min_shift;
+    while (((size_t) 1 << shift) < block_size)
+        shift++;
+    return shift;
+}
+
+static void *pool_alloc(ndarray_pool *pool, size_t block_size,
+                        bool huge_pages) {
+    void *ptr = nullptr;
+
+    {
+        std::lock_guard<std::mutex> guard(pool->mutex);
+        if (block_size <= ((size_t) 1 << pool_max_shift)) {
+            pool_block *&head = pool->free_list[pool_class(block_size)];
+            if (head) {
+                ptr = head;
+                head = head->next;
+                pool->cached -= block_size;
+            }
+        }
+        pool->live++;
+    }
+
+    if (!ptr) {
+        ptr = pool_aligned_alloc(block_size);
+        if (!ptr) {
+            std::lock_guard<std::mutex> guard(pool->mutex);
+            pool->live--;
+            return nullptr;
+        }
+    }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (huge_pages && block_size >= huge_page_size)
+        madvise(ptr, block_size, MADV_HUGEPAGE);
+#else
+    (void) huge_pages;
+#endif
+
+    return ptr;
+}
+
+static void pool_free(ndarray_pool *pool, void *ptr, size_t block_size) {
+    bool cache, destroy;
+    {
+        std::lock_guard<std::mutex> guard(pool->mutex);
+        cache = pool->alive && block_size <= ((size_t) 1 << pool_max_shift) &&
+                pool->cached + block_size <= pool_max_cached;
+        if (cache) {
+            pool_block *b = (pool_block *) ptr;
+            pool_block *&head = pool->free_list[pool_class(block_size)];
+            b->next = head;
+            head = b;
+            pool->cached += block_size;
+        }
+        destroy = --pool->live == 0 && !pool->alive;
+    }
+
+    if (!cache)
+        pool_aligned_free(ptr);
+    if (destroy)
+        delete pool;
+}
+
+/// Release cached blocks at shutdown. Blocks still in use free the pool later
+void ndarray_pool_shutdown(ndarray_pool *pool) noexcept {
+    bool destroy;
+    {
+        std::lock_guard<std::mutex> guard(pool->mutex);
+        for (size_t i = pool_min_shift; i <= pool_max_shift; ++i) {
+            pool_block *b = pool->free_list[i];
+            while (b) {
+                pool_block *next = b->next;
+                pool_aligned_free(b);
+                b = next;
+            }
+            pool->free_list[i] = nullptr;
+        }
+        pool->cached = 0;
+        pool->alive = false;
+        destroy = pool->live == 0;
+    }
+
+    if (destroy)
+        delete pool;
+}
+
+static void file_unmap(void *ptr, size_t size) {
+#if defined(_WIN32)
+    (void) size;
+    UnmapViewOfFile(ptr);
+#else
+    munmap(ptr, size);
+#endif
+}
+
 static void nb_ndarray_dealloc(PyObject *self) {
     PyTypeObject *tp = Py_TYPE(self);
     ndarray_dec_ref(((nb_ndarray *) self)->th);
@@ -80,19 +250,39 @@ static int nd_ndarray_tpbuffer(PyObject *exporter, Py_buffer *view, int) {
             format = "?";
             break;
 
+        case dlpack::dtype_code::Bfloat:
+            /* The buffer protocol lacks a bfloat16 format. Expose the raw bits,
+               ndarray_wrap() reinterprets them via the 'ml_dtypes' package. */
+            if (t.dtype.bits == 16)
+                format = "H";
+            break;
+
         default:
             break;
     }
 
-    if (!format || t.dtype.lanes != 1) {
+    if (!format || t.dtype.lanes == 0) {
         PyErr_SetString(
             PyExc_BufferError,
             "Don't know how to convert DLPack dtype into buffer protocol format!");
         return -1;
     }
 
+    // Vector types are exposed using a repeat count, e.g. "4f"
+    char *format_lanes = nullptr;
+    if (t.dtype.lanes != 1) {
+        size_t size = strlen(format) + 8;
+        format_lanes = (char *) PyMem_Malloc(size);
+        if (!format_lanes) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        snprintf(format_lanes, size, "%u%s", (unsigned) t.dtype.lanes, format);
+        format = format_lanes;
+    }
+
     view->format = (char *) format;
-    view->itemsize = t.dtype.bits / 8;
+    view->itemsize = (Py_ssize_t) t.dtype.bits * t.dtype.lanes / 8;
     view->buf = (void *) ((uintptr_t) t.data + t.byte_offset);
     view->obj = exporter;
     Py_INCREF(exporter);
@@ -111,7 +301,7 @@ static int nd_ndarray_tpbuffer(PyObject *exporter, Py_buffer *view, int) {
     view->len = len;
     view->readonly = self->th->ro;
     view->suboffsets = nullptr;
-    view->internal = nullptr;
+    view->internal = format_lanes;
     view->strides = strides.release();
     view->shape = shape.release();
 
@@ -121,6 +311,7 @@ static int nd_ndarray_tpbuffer(PyObject *exporter, Py_buffer *view, int) {
 static void nb_ndarray_releasebuffer(PyObject *, Py_buffer *view) {
     PyMem_Free(view->shape);
     PyMem_Free(view->strides);
+    PyMem_Free(view->internal);
 }
 
 static PyTypeObject *nd_ndarray_tp() noexcept {
@@ -190,7 +381,14 @@ static PyObject *dlpack_from_buffer_protocol(PyObject *o, bool ro) {
     dlpack::dtype dt { };
     bool fail = format_str && format_str[1] != '\0';
 
-    if (!fail) {
+    // Complex-valued buffers use a two-character format ("Zf", "Zd")
+    if (fail && format == 'Z' && format_str[2] == '\0' &&
+        (format_str[1] == 'e' || format_str[1] == 'f' || format_str[1] == 'd')) {
+        dt.code = (uint8_t) dlpack::dtype_code::Complex;
+        dt.lanes = 1;
+        dt.bits = (uint8_t) (view->itemsize * 8);
+        fail = false;
+    } else if (!fail) {
         switch (format) {
             case 'c':
             case 'b':
@@ -275,6 +473,33 @@ static PyObject *dlpack_from_buffer_protocol(PyObject *o, bool ro) {
     });
 }
 
+/* NumPy arrays using the 'ml_dtypes.bfloat16' type support neither DLPack nor
+   the buffer protocol. Import them through a 16-bit unsigned integer view. */
+static PyObject *dlpack_from_bfloat16_array(PyObject *o, bool ro) {
+    PyObject *dtype = PyObject_GetAttrString(o, "dtype"),
+             *name = dtype ? PyObject_GetAttrString(dtype, "name") : nullptr;
+    Py_XDECREF(dtype);
+
+    const char *name_str = name ? PyUnicode_AsUTF8AndSize(name, nullptr) : nullptr;
+    bool is_bfloat16 = name_str && strcmp(name_str, "bfloat16") == 0;
+    Py_XDECREF(name);
+
+    PyObject *view = is_bfloat16 ? PyObject_CallMethod(o, "view", "s", "uint16")
+                                 : nullptr,
+             *capsule = view ? dlpack_from_buffer_protocol(view, ro) : nullptr;
+    Py_XDECREF(view);
+
+    if (!capsule) {
+        PyErr_Clear();
+        return nullptr;
+    }
+
+    managed_dltensor *mt =
+        (managed_dltensor *) PyCapsule_GetPointer(capsule, "dltensor");
+    mt->dltensor.dtype.code = (uint8_t) dlpack::dtype_code::Bfloat;
+    return capsule;
+}
+
 bool ndarray_check(PyObject *o) noexcept {
     PyTypeObject *tp = Py_TYPE(o);
 
@@ -335,6 +560,9 @@ ndarray_handle *ndarray_import(PyObject *o, const ndarray_req *req,
         if (!capsule.is_valid())
             capsule = steal(dlpack_from_buffer_protocol(o, req->req_ro));
 
+        if (!capsule.is_valid())
+            capsule = steal(dlpack_from_bfloat16_array(o, req->req_ro));
+
         if (!capsule.is_valid())
             return nullptr;
     } else {
@@ -431,7 +659,7 @@ ndarray_handle *ndarray_import(PyObject *o, const ndarray_req *req,
             return nullptr;
 
         const char *prefix = nullptr;
-        char dtype[9];
+        char dtype[16];
         if (dt.code == (uint8_t) dlpack::dtype_code::Bool) {
             std::strcpy(dtype, "bool");
         } else {
@@ -439,6 +667,8 @@ ndarray_handle *ndarray_import(PyObject *o, const ndarray_req *req,
                 case (uint8_t) dlpack::dtype_code::Int: prefix = "int"; break;
                 case (uint8_t) dlpack::dtype_code::UInt: prefix = "uint"; break;
                 case (uint8_t) dlpack::dtype_code::Float: prefix = "float"; break;
+                case (uint8_t) dlpack::dtype_code::Bfloat: prefix = "bfloat"; break;
+                case (uint8_t) dlpack::dtype_code::Complex: prefix = "complex"; break;
                 default:
                     return nullptr;
             }
@@ -448,6 +678,9 @@ ndarray_handle *ndarray_import(PyObject *o, const ndarray_req *req,
         object converted;
         try {
             if (strcmp(module_name, "numpy") == 0) {
+                // Importing 'ml_dtypes' registers the "bfloat16" dtype name
+                if (dt.code == (uint8_t) dlpack::dtype_code::Bfloat)
+                    module_::import_("ml_dtypes");
                 converted = handle(o).attr("astype")(dtype, order);
             } else if (strcmp(module_name, "torch") == 0) {
                 converted = handle(o).attr("to")(
@@ -482,6 +715,12 @@ ndarray_handle *ndarray_import(PyObject *o, const ndarray_req *req,
     result->ndarray = (managed_dltensor *) ptr;
     result->refcount = 0;
     result->owner = nullptr;
+    result->pool = nullptr;
+    result->storage = nullptr;
+    result->storage_size = 0;
+    result->mapping = nullptr;
+    result->mapping_size = 0;
+    result->parent = nullptr;
     result->free_shape = false;
     result->call_deleter = true;
     result->ro = req->req_ro;
@@ -541,7 +780,13 @@ void ndarray_dec_ref(ndarray_handle *th) noexcept {
         } else {
             PyMem_Free(mt);
         }
+        if (th->storage)
+            pool_free(th->pool, th->storage, th->storage_size);
+        if (th->mapping)
+            file_unmap(th->mapping, th->mapping_size);
+        ndarray_handle *parent = th->parent;
         PyMem_Free(th);
+        ndarray_dec_ref(parent);
     }
 }
 
@@ -600,6 +845,12 @@ ndarray_handle *ndarray_create(void *value, size_t ndim, const size_t *shape_in,
     result->refcount = 0;
     result->owner = owner;
     result->self = nullptr;
+    result->pool = nullptr;
+    result->storage = nullptr;
+    result->storage_size = 0;
+    result->mapping = nullptr;
+    result->mapping_size = 0;
+    result->parent = nullptr;
     result->free_shape = true;
     result->free_strides = true;
     result->call_deleter = false;
@@ -608,6 +859,356 @@ ndarray_handle *ndarray_create(void *value, size_t ndim, const size_t *shape_in,
     return result.release();
 }
 
+/// Compute the strides of a C- or F-contiguous array
+static void contig_strides(size_t ndim, const size_t *shape, char order,
+                           int64_t *strides) {
+    if (ndim == 0)
+        return;
+
+    int64_t accum = 1;
+    if (order == 'F') {
+        for (size_t i = 0; i < ndim; ++i) {
+            strides[i] = accum;
+            accum *= (int64_t) shape[i];
+        }
+    } else {
+        for (size_t i = ndim - 1; ;) {
+            strides[i] = accum;
+            accum *= (int64_t) shape[i];
+            if (i == 0)
+                break;
+            --i;
+        }
+    }
+}
+
+/// Compute 'a *= b', returning 'false' when the result would overflow
+static bool mul_checked(uint64_t &a, uint64_t b) {
+    if (b != 0 && a > UINT64_MAX / b)
+        return false;
+    a *= b;
+    return true;
+}
+
+/// Create a handle referencing a region of the data of 'th' (no copy)
+static ndarray_handle *ndarray_view(ndarray_handle *th, int64_t offset,
+                                    size_t ndim, const int64_t *shape,
+                                    const int64_t *strides) {
+    const dlpack::dltensor &t = th->ndarray->dltensor;
+    size_t *shape_u = (size_t *) alloca(sizeof(size_t) * (ndim ? ndim : 1));
+    for (size_t i = 0; i < ndim; ++i)
+        shape_u[i] = (size_t) shape[i];
+
+    int64_t itemsize = (int64_t) ((t.dtype.bits * t.dtype.lanes + 7) / 8);
+    uint8_t *data = (uint8_t *) t.data + t.byte_offset + offset * itemsize;
+    dlpack::dtype dtype = t.dtype;
+
+    ndarray_handle *result =
+        ndarray_create(data, ndim, shape_u, nullptr, strides, &dtype, th->ro,
+                       t.device.device_type, t.device.device_id);
+
+    // Views of views directly reference the array that owns the storage
+    result->parent = th->parent ? th->parent : th;
+    ndarray_inc_ref(result->parent);
+    return result;
+}
+
+ndarray_handle *ndarray_slice(ndarray_handle *th, size_t axis, int64_t start,
+                              int64_t stop, int64_t step) {
+    const dlpack::dltensor &t = th->ndarray->dltensor;
+    if (axis >= (size_t) t.ndim)
+        throw index_error("ndarray::slice(): axis is out of bounds!");
+    if (step == 0)
+        throw value_error("ndarray::slice(): step cannot be zero!");
+
+    Py_ssize_t start_i = (Py_ssize_t) start, stop_i = (Py_ssize_t) stop;
+    int64_t size = (int64_t) PySlice_AdjustIndices(
+        (Py_ssize_t) t.shape[axis], &start_i, &stop_i, (Py_ssize_t) step);
+
+    int64_t *shape = (int64_t *) alloca(sizeof(int64_t) * t.ndim),
+            *strides = (int64_t *) alloca(sizeof(int64_t) * t.ndim);
+    memcpy(shape, t.shape, sizeof(int64_t) * t.ndim);
+    memcpy(strides, t.strides, sizeof(int64_t) * t.ndim);
+    shape[axis] = size;
+    strides[axis] = t.strides[axis] * step;
+
+    return ndarray_view(th, size > 0 ? start_i * t.strides[axis] : 0,
+                        (size_t) t.ndim, shape, strides);
+}
+
+ndarray_handle *ndarray_select(ndarray_handle *th, size_t axis,
+                               int64_t index) {
+    const dlpack::dltensor &t = th->ndarray->dltensor;
+    if (axis >= (size_t) t.ndim)
+        throw index_error("ndarray::select(): axis is out of bounds!");
+    if (index < 0)
+        index += t.shape[axis];
+    if (index < 0 || index >= t.shape[axis])
+        throw index_error("ndarray::select(): index is out of bounds!");
+
+    size_t ndim = (size_t) t.ndim - 1;
+    int64_t *shape = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1)),
+            *strides = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1));
+    for (size_t i = 0, j = 0; i < (size_t) t.ndim; ++i) {
+        if (i == axis)
+            continue;
+        shape[j] = t.shape[i];
+        strides[j++] = t.strides[i];
+    }
+
+    return ndarray_view(th, index * t.strides[axis], ndim, shape, strides);
+}
+
+ndarray_handle *ndarray_transpose(ndarray_handle *th, size_t ndim,
+                                  const size_t *axes) {
+    const dlpack::dltensor &t = th->ndarray->dltensor;
+    if (axes && ndim != (size_t) t.ndim)
+        throw value_error("ndarray::transpose(): axes don't match array!");
+    ndim = (size_t) t.ndim;
+
+    int64_t *shape = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1)),
+            *strides = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1));
+    bool *seen = (bool *) alloca(ndim + 1);
+    memset(seen, 0, ndim + 1);
+
+    for (size_t i = 0; i < ndim; ++i) {
+        size_t k = axes ? axes[i] : ndim - 1 - i;
+        if (k >= ndim || seen[k])
+            throw value_error("ndarray::transpose(): invalid axes!");
+        seen[k] = true;
+        shape[i] = t.shape[k];
+        strides[i] = t.strides[k];
+    }
+
+    return ndarray_view(th, 0, ndim, shape, strides);
+}
+
+ndarray_handle *ndarray_reshape(ndarray_handle *th, size_t ndim,
+                                const size_t *shape_in) {
+    const dlpack::dltensor &t = th->ndarray->dltensor;
+
+    int64_t size = 1, size_in = 1;
+    for (int32_t i = 0; i < t.ndim; ++i)
+        size *= t.shape[i];
+    for (size_t i = 0; i < ndim; ++i)
+        size_in *= (int64_t) shape_in[i];
+    if (size != size_in)
+        throw value_error("ndarray::reshape(): the requested shape has an "
+                          "incompatible number of elements!");
+
+    // Dimensions of size 1 don't constrain the memory layout
+    bool c_contig = true, f_contig = true;
+    int64_t accum = 1;
+    for (int32_t i = t.ndim - 1; i >= 0; --i) {
+        c_contig &= t.shape[i] == 1 || t.strides[i] == accum;
+        accum *= t.shape[i];
+    }
+    accum = 1;
+    for (int32_t i = 0; i < t.ndim; ++i) {
+        f_contig &= t.shape[i] == 1 || t.strides[i] == accum;
+        accum *= t.shape[i];
+    }
+    if (!c_contig && !f_contig && size > 1)
+        throw value_error("ndarray::reshape(): the array must be contiguous!");
+
+    int64_t *shape = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1)),
+            *strides = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1));
+    for (size_t i = 0; i < ndim; ++i)
+        shape[i] = (int64_t) shape_in[i];
+    contig_strides(ndim, shape_in, c_contig ? 'C' : 'F', strides);
+
+    return ndarray_view(th, 0, ndim, shape, strides);
+}
+
+
+ndarray_handle *ndarray_alloc(size_t ndim, const size_t *shape,
+                              dlpack::dtype *dtype, char order, bool zero,
+                              bool huge_pages, bool ro) {
+    uint64_t size = ((uint64_t) dtype->bits * dtype->lanes + 7) / 8;
+    bool overflow = false;
+    for (size_t i = 0; i < ndim; ++i)
+        overflow |= !mul_checked(size, (uint64_t) shape[i]);
+
+    if (overflow || size > (uint64_t) PTRDIFF_MAX)
+        throw value_error("ndarray::empty()/zeros(): the size of the "
+                          "requested array overflows!");
+
+    scoped_pymalloc<int64_t> strides(ndim);
+    contig_strides(ndim, shape, order, strides.get());
+
+    ndarray_pool *pool = internals->nb_ndarray_pool;
+    if (!pool)
+        pool = internals->nb_ndarray_pool = new ndarray_pool();
+
+    size_t block_size = pool_block_size((size_t) size);
+    void *ptr = pool_alloc(pool, block_size, huge_pages);
+    if (!ptr)
+        throw std::bad_alloc();
+
+    if (zero)
+        memset(ptr, 0, (size_t) size);
+
+    ndarray_handle *result =
+        ndarray_create(ptr, ndim, shape, nullptr, strides.get(), dtype, ro,
+                       device::cpu::value, 0);
+    result->pool = pool;
+    result->storage = ptr;
+    result->storage_size = block_size;
+    return result;
+}
+
+// ========================================================================
+
+[[noreturn]] static void file_map_error(const char *filename) {
+#if defined(_WIN32)
+    PyErr_SetFromWindowsErr(0);
+    (void) filename;
+#else
+    PyErr_SetFromErrnoWithFilename(PyExc_OSError, filename);
+#endif
+    raise_python_error();
+}
+
+ndarray_handle *ndarray_map_file(const char *filename, size_t ndim,
+                                 const size_t *shape, dlpack::dtype *dtype,
+                                 char order, uint64_t offset, bool writable,
+                                 int advice) {
+    size_t itemsize = ((size_t) dtype->bits * dtype->lanes + 7) / 8;
+    size_t size_1d = 0;
+
+#if defined(_WIN32)
+    int wlen = MultiByteToWideChar(CP_UTF8, 0, filename, -1, nullptr, 0);
+    scoped_pymalloc<wchar_t> wfilename((size_t) (wlen > 0 ? wlen : 1));
+    if (wlen <= 0 || !MultiByteToWideChar(CP_UTF8, 0, filename, -1,
+                                          wfilename.get(), wlen))
+        file_map_error(filename);
+
+    HANDLE file = CreateFileW(wfilename.get(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        file_map_error(filename);
+
+    LARGE_INTEGER file_size_li;
+    if (!GetFileSizeEx(file, &file_size_li)) {
+        CloseHandle(file);
+        file_map_error(filename);
+    }
+    uint64_t file_size = (uint64_t) file_size_li.QuadPart;
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    uint64_t granularity = (uint64_t) si.dwAllocationGranularity;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        file_map_error(filename);
+
+    struct stat st;
+    if (fstat(fd, &st)) {
+        close(fd);
+        file_map_error(filename);
+    }
+    uint64_t file_size = (uint64_t) st.st_size;
+    uint64_t granularity = (uint64_t) sysconf(_SC_PAGESIZE);
+#endif
+
+    auto close_file = [&]() {
+#if defined(_WIN32)
+        CloseHandle(file);
+#else
+        close(fd);
+#endif
+    };
+
+    // Without a shape, map the remainder of the file as a 1D array
+    if (!shape) {
+        size_1d = offset < file_size ? (size_t) ((file_size - offset) / itemsize) : 0;
+        ndim = 1;
+        shape = &size_1d;
+    }
+
+    uint64_t nbytes = itemsize;
+    bool overflow = false;
+    for (size_t i = 0; i < ndim; ++i)
+        overflow |= !mul_checked(nbytes, (uint64_t) shape[i]);
+
+    if (overflow || offset > file_size || nbytes > file_size - offset) {
+        close_file();
+        PyErr_Format(PyExc_ValueError,
+                     "nanobind::ndarray::map_file(): the file \"%s\" is too "
+                     "small (%llu bytes) to hold the requested array!",
+                     filename, (unsigned long long) file_size);
+        raise_python_error();
+    }
+
+    // The mapping must start at a multiple of the page size/granularity
+    uint64_t map_offset = offset - offset % granularity;
+    size_t map_size = (size_t) (nbytes + (offset - map_offset));
+    void *mapping = nullptr;
+    uint8_t *data;
+
+    if (nbytes == 0) {
+        static uint8_t empty = 0;
+        data = &empty;
+    } else {
+#if defined(_WIN32)
+        HANDLE fmap = CreateFileMappingW(
+            file, nullptr, writable ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0,
+            nullptr);
+        if (fmap)  {
+            mapping = MapViewOfFile(
+                fmap, writable ? FILE_MAP_COPY : FILE_MAP_READ,
+                (DWORD) (map_offset >> 32), (DWORD) map_offset, map_size);
+            CloseHandle(fmap);
+        }
+        if (!mapping) {
+            close_file();
+            file_map_error(filename);
+        }
+        (void) advice;
+#else
+        mapping = mmap(nullptr, map_size,
+                       writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                       MAP_PRIVATE, fd, (off_t) map_offset);
+        if (mapping == MAP_FAILED) {
+            close_file();
+            file_map_error(filename);
+        }
+
+        int hint = POSIX_MADV_NORMAL;
+        switch ((mmap_advice) advice) {
+            case mmap_advice::sequential: hint = POSIX_MADV_SEQUENTIAL; break;
+            case mmap_advice::random: hint = POSIX_MADV_RANDOM; break;
+            case mmap_advice::willneed: hint = POSIX_MADV_WILLNEED; break;
+            default: break;
+        }
+        if (hint != POSIX_MADV_NORMAL)
+            posix_madvise(mapping, map_size, hint);
+#endif
+        data = (uint8_t *) mapping + (offset - map_offset);
+    }
+
+    // The mapping remains valid after the file has been closed
+    close_file();
+
+    ndarray_handle *result;
+    try {
+        scoped_pymalloc<int64_t> strides(ndim);
+        contig_strides(ndim, shape, order, strides.get());
+
+        result = ndarray_create(data, ndim, shape, nullptr, strides.get(),
+                                dtype, !writable, device::cpu::value, 0);
+    } catch (...) {
+        if (mapping)
+            file_unmap(mapping, map_size);
+        throw;
+    }
+
+    result->mapping = mapping;
+    result->mapping_size = map_size;
+    return result;
+}
+
 static void ndarray_capsule_destructor(PyObject *o) {
     error_scope scope; // temporarily save any existing errors
     managed_dltensor *mt =
@@ -641,8 +1242,14 @@ PyObject *ndarray_wrap(ndarray_handle *th, int framework,
             }
             [[fallthrough]];
 
-        case rv_policy::automatic:
-            copy = th->owner == nullptr && th->self == nullptr;
+        case rv_policy::automatic: {
+                // Views are copied if and only if they and their parent would be
+                const ndarray_handle *p = th->parent;
+                copy = th->owner == nullptr && th->self == nullptr &&
+                       th->storage == nullptr && th->mapping == nullptr &&
+                       (!p || (p->owner == nullptr && p->self == nullptr &&
+                               p->storage == nullptr && p->mapping == nullptr));
+            }
             break;
 
         case rv_policy::copy:
@@ -673,10 +1280,15 @@ PyObject *ndarray_wrap(ndarray_handle *th, int framework,
             ndarray_inc_ref(th);
 
             object o = steal((PyObject *) h);
-            return module_::import_("numpy")
-                .attr("array")(o, arg("copy") = copy)
-                .release()
-                .ptr();
+            o = module_::import_("numpy").attr("array")(o, arg("copy") = copy);
+
+            // NumPy lacks a native bfloat16 type, use the one from 'ml_dtypes'
+            if (th->ndarray->dltensor.dtype.code ==
+                (uint8_t) dlpack::dtype_code::Bfloat)
+                o = o.attr("view")(
+                    module_::import_("ml_dtypes").attr("bfloat16"));
+
+            return o.release().ptr();
         } catch (const std::exception &e) {
             PyErr_Format(PyExc_RuntimeError,
                          "nanobind::detail::ndarray_wrap(): could not "
@@ -751,5 +1363,158 @@ PyObject *ndarray_wrap(ndarray_handle *th, int framework,
     return o.release().ptr();
 }
 
+void ndarray_iterate(size_t n, const dlpack::dltensor *tensors,
+                     ndarray_iterate_cb cb, void *payload) {
+    if (n == 0 || n > 32)
+        raise("nanobind::nditer(): the number of operands must be between 1 and 32!");
+
+    size_t ndim = 0;
+    for (size_t k = 0; k < n; ++k) {
+        if (tensors[k].ndim < 0 || tensors[k].ndim > 32)
+            raise("nanobind::nditer(): operands may have at most 32 dimensions!");
+        if (tensors[k].device.device_type != device::cpu::value)
+            throw value_error("nanobind::nditer(): operands must reside in "
+                              "CPU memory!");
+        if ((size_t) tensors[k].ndim > ndim)
+            ndim = (size_t) tensors[k].ndim;
+    }
+
+    /* Per-dimension state. Strides are stored in bytes, and the
+       dimensions are stored from the innermost to the outermost one */
+    int64_t *shape = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1)),
+            *index = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1)),
+            *strides = (int64_t *) alloca(sizeof(int64_t) * (ndim + 1) * n),
+            *inner = (int64_t *) alloca(sizeof(int64_t) * n);
+    uint8_t **ptrs = (uint8_t **) alloca(sizeof(uint8_t *) * n);
+
+    // 1. Compute the broadcast shape (right-aligned, NumPy semantics)
+    bool empty = false;
+    for (size_t i = 0; i < ndim; ++i) {
+        int64_t size = 1;
+        for (size_t k = 0; k < n; ++k) {
+            const dlpack::dltensor &t = tensors[k];
+            if (i >= (size_t) t.ndim)
+                continue;
+            int64_t value = t.shape[(size_t) t.ndim - 1 - i];
+            if (value == size || value == 1)
+                continue;
+            if (size != 1)
+                throw value_error("nanobind::nditer(): operands could not be "
+                                  "broadcast together!");
+            size = value;
+        }
+        shape[i] = size;
+        empty |= size == 0;
+    }
+
+    if (empty)
+        return;
+
+    for (size_t k = 0; k < n; ++k) {
+        const dlpack::dltensor &t = tensors[k];
+        int64_t itemsize = ((int64_t) t.dtype.bits * t.dtype.lanes + 7) / 8;
+        ptrs[k] = (uint8_t *) t.data + t.byte_offset;
+
+        int64_t accum = 1; // missing strides imply a C-contiguous layout
+        for (size_t i = 0; i < ndim; ++i) {
+            int64_t value = 0;
+            if (i < (size_t) t.ndim) {
+                size_t j = (size_t) t.ndim - 1 - i;
+                int64_t stride = t.strides ? t.strides[j] : accum;
+                accum *= t.shape[j];
+                if (t.shape[j] != 1)
+                    value = stride * itemsize;
+            }
+            strides[i * n + k] = value;
+        }
+    }
+
+    // 2. Drop singleton dimensions
+    size_t m = 0;
+    for (size_t i = 0; i < ndim; ++i) {
+        if (shape[i] == 1)
+            continue;
+        shape[m] = shape[i];
+        for (size_t k = 0; k < n; ++k)
+            strides[m * n + k] = strides[i * n + k];
+        ++m;
+    }
+    ndim = m;
+
+    /* 3. Reorder dimensions so that those with the smallest strides are
+       visited in the innermost loop. The first operand with a nonzero stride
+       along both dimensions decides. Insertion sort: 'ndim' is tiny. */
+    auto is_inner = [&](size_t a, size_t b) {
+        for (size_t k = 0; k < n; ++k) {
+            int64_t sa = strides[a * n + k], sb = strides[b * n + k];
+            if (sa == 0 || sb == 0)
+                continue;
+            sa = sa < 0 ? -sa : sa;
+            sb = sb < 0 ? -sb : sb;
+            if (sa != sb)
+                return sa < sb;
+        }
+        return false;
+    };
+
+    for (size_t i = 1; i < ndim; ++i) {
+        for (size_t j = i; j > 0 && is_inner(j, j - 1); --j) {
+            std::swap(shape[j], shape[j - 1]);
+            for (size_t k = 0; k < n; ++k)
+                std::swap(strides[j * n + k], strides[(j - 1) * n + k]);
+        }
+    }
+
+    // 4. Coalesce adjacent dimensions that are laid out contiguously
+    m = 0;
+    for (size_t i = 1; i < ndim; ++i) {
+        bool mergeable = true;
+        for (size_t k = 0; k < n; ++k)
+            mergeable &= strides[i * n + k] == strides[m * n + k] * shape[m];
+
+        if (mergeable) {
+            shape[m] *= shape[i];
+        } else {
+            ++m;
+            shape[m] = shape[i];
+            for (size_t k = 0; k < n; ++k)
+                strides[m * n + k] = strides[i * n + k];
+        }
+    }
+    ndim = ndim ? (m + 1) : 0;
+
+    // 0-dimensional case: a single inner loop iteration
+    if (ndim == 0) {
+        shape[0] = 1;
+        for (size_t k = 0; k < n; ++k)
+            strides[k] = 0;
+        ndim = 1;
+    }
+
+    // 5. Run the outer loops and invoke the callback for each inner loop
+    for (size_t k = 0; k < n; ++k)
+        inner[k] = strides[k];
+    for (size_t i = 1; i < ndim; ++i)
+        index[i] = 0;
+
+    while (true) {
+        cb(payload, (void **) ptrs, inner, (size_t) shape[0]);
+
+        size_t i = 1;
+        for (; i < ndim; ++i) {
+            for (size_t k = 0; k < n; ++k)
+                ptrs[k] += strides[i * n + k];
+            if (++index[i] < shape[i])
+                break;
+            for (size_t k = 0; k < n; ++k)
+                ptrs[k] -= strides[i * n + k] * shape[i];
+            index[i] = 0;
+        }
+
+        if (i == ndim)
+            break;
+    }
+}
+
 NAMESPACE_END(detail)
 NAMESPACE_END(NB_NAMESPACE)
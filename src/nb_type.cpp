@@ -75,7 +75,7 @@ PyObject *inst_new_int(PyTypeObject *tp) {
         self->cpp_delete = 0;
         self->clear_keep_alive = 0;
         self->intrusive = intrusive;
-        self->unused = 0;
+        self->exports = 0;
 
         // Update hash table that maps from C++ to Python instance
         auto [it, success] = internals->inst_c2p.try_emplace((void *) payload, self);
@@ -136,7 +136,7 @@ PyObject *inst_new_ext(PyTypeObject *tp, void *value) {
     self->cpp_delete = 0;
     self->clear_keep_alive = 0;
     self->intrusive = intrusive;
-    self->unused = 0;
+    self->exports = 0;
 
     // Update hash table that maps from C++ to Python instance
     auto [it, success] = internals->inst_c2p.try_emplace(value, self);
@@ -296,8 +296,17 @@ static void nb_type_dealloc(PyObject *o) {
         free(t->implicit_py);
     }
 
+    if (t->flags & (uint32_t) type_flags::is_enum)
+        nb_enum_table_free((PyTypeObject *) o);
+
+    if (t->overrides)
+        override_table_free(t->overrides);
+
     free((char *) t->name);
 
+    // Invalidate caches keyed on the address of the type (see nb_type_epoch())
+    internals->type_epoch++;
+
     NB_SLOT(PyType_Type, tp_dealloc)(o);
 }
 
@@ -344,6 +353,7 @@ static int nb_type_init(PyObject *self, PyObject *args, PyObject *kwds) {
     t->type_py = (PyTypeObject *) self;
     t->implicit = nullptr;
     t->implicit_py = nullptr;
+    t->overrides = nullptr;
 
     return 0;
 }
@@ -382,7 +392,13 @@ static int nb_type_setattro(PyObject* obj, PyObject* name, PyObject* value) {
         PyErr_Clear();
     }
 
-    return NB_SLOT(PyType_Type, tp_setattro)(obj, name, value);
+    int rv = NB_SLOT(PyType_Type, tp_setattro)(obj, name, value);
+
+    // Reassigned or deleted methods invalidate cached trampoline lookups
+    if (rv == 0 && int_p->override_tables)
+        override_invalidate((PyTypeObject *) obj, name);
+
+    return rv;
 }
 
 #if NB_TYPE_FROM_METACLASS_IMPL || NB_TYPE_GET_SLOT_IMPL
@@ -902,6 +918,7 @@ PyObject *nb_type_new(const type_init_data *t) noexcept {
 
     to->name = name_copy;
     to->type_py = (PyTypeObject *) result;
+    to->overrides = nullptr;
 
     if (has_dynamic_attr) {
         to->flags |= (uint32_t) type_flags::has_dynamic_attr;
@@ -1164,9 +1181,46 @@ void keep_alive(PyObject *nurse, void *payload,
     }
 }
 
+void *keep_alive_payload(PyObject *nurse,
+                         void (*callback)(void *) noexcept) noexcept {
+    if (!nb_type_check((PyObject *) Py_TYPE(nurse)) ||
+        !((nb_inst *) nurse)->clear_keep_alive)
+        return nullptr;
+
+    nb_ptr_map &keep_alive = internals->keep_alive;
+    nb_ptr_map::iterator it = keep_alive.find(nurse);
+    if (it == keep_alive.end())
+        return nullptr;
+
+    for (nb_weakref_seq *s = (nb_weakref_seq *) it->second; s; s = s->next) {
+        if (s->callback == callback)
+            return s->payload;
+    }
+
+    return nullptr;
+}
+
 static PyObject *nb_type_put_common(void *value, type_data *t, rv_policy rvp,
                                     cleanup_list *cleanup,
                                     bool *is_new) noexcept {
+    /* Enumeration values map onto the instances of their named entries,
+       unless the caller asked for an instance referencing 'value' */
+    if ((t->flags & (uint32_t) type_flags::is_enum) &&
+        (rvp == rv_policy::copy || rvp == rv_policy::move ||
+         rvp == rv_policy::automatic || rvp == rv_policy::take_ownership)) {
+        PyObject *entry = nb_enum_get(t->type_py, value);
+        if (entry) {
+            if (is_new)
+                *is_new = false;
+
+            // Enumerations are trivially destructible
+            if (rvp == rv_policy::take_ownership)
+                operator delete(value);
+
+            return entry;
+        }
+    }
+
     // The reference_internals RVP needs a self pointer, give up if unavailable
     if (rvp == rv_policy::reference_internal && (!cleanup || !cleanup->self()))
         return nullptr;
@@ -1527,6 +1581,27 @@ PyObject *nb_type_lookup(const std::type_info *t) noexcept {
     return nullptr;
 }
 
+size_t nb_type_epoch() noexcept { return internals->type_epoch; }
+
+bool nb_type_rejects(const std::type_info *t, PyTypeObject *tp,
+                     bool convert) noexcept {
+    // 'None' converts to a null pointer, depending on the argument annotation
+    if (tp == Py_TYPE(Py_None))
+        return false;
+
+    nb_type_map &type_c2p = internals->type_c2p;
+    auto it = type_c2p.find(std::type_index(*t));
+    if (it == type_c2p.end())
+        return true;
+
+    type_data *td = it->second;
+    if (PyType_IsSubtype(tp, td->type_py))
+        return false;
+
+    return !convert ||
+           !(td->flags & (uint32_t) type_flags::has_implicit_conversions);
+}
+
 bool nb_type_check(PyObject *t) noexcept {
     PyTypeObject *meta  = Py_TYPE(t),
                  *meta2 = Py_TYPE((PyObject *) meta);
@@ -1720,6 +1795,19 @@ PyObject *nb_inst_name(PyObject *o) noexcept {
         return nb_type_name((PyObject *) Py_TYPE(o));
 }
 
+uint32_t nb_inst_exports(PyObject *o) noexcept {
+    return ((nb_inst *) o)->exports;
+}
+
+bool nb_inst_add_exports(PyObject *o, int delta) noexcept {
+    nb_inst *nbi = (nb_inst *) o;
+    uint32_t value = nbi->exports + (uint32_t) delta;
+    if (value >= (1u << 25))
+        return false;
+    nbi->exports = value;
+    return true;
+}
+
 bool nb_inst_python_derived(PyObject *o) noexcept {
     return nb_type_data(Py_TYPE(o))->flags &
            (uint32_t) type_flags::is_python_type;
@@ -9,10 +9,238 @@
 
 #include <nanobind/trampoline.h>
 #include "nb_internals.h"
+#include <atomic>
+#include <cstring>
+#include <new>
 
 NAMESPACE_BEGIN(NB_NAMESPACE)
 NAMESPACE_BEGIN(detail)
 
+/// Cached result of an override lookup
+struct override_entry {
+    std::atomic<const char *> name;
+
+    /// Interned name of the Python override, or Py_None if there is none
+    std::atomic<PyObject *> key;
+};
+
+/**
+ * Array of cached override lookups of a type. Arrays that were replaced
+ * because they ran out of space remain allocated (via 'prev') until the type
+ * is destroyed, since other threads may still be reading them. The capacity
+ * doubles each time, which bounds the number of such arrays.
+ */
+struct override_array {
+    override_array *prev;
+    size_t capacity;
+    override_entry entries[1];
+};
+
+/// Number of 64-bit words of the filter in 'override_table'
+constexpr size_t override_filter_size = 4;
+
+/**
+ * Override lookups of a type, shared by all of its instances. The table is
+ * only modified while holding the GIL. Threads that do not hold it may read
+ * the table concurrently: new entries are published by incrementing 'size',
+ * and other modifications are bracketed by two increments of 'version'
+ * (which is odd while they are in progress).
+ *
+ * The 'filter' field is a Bloom filter of the attribute names defined by
+ * Python classes in the MRO of the type. Virtual functions whose name is
+ * absent from it cannot have a Python override, which can be determined
+ * without holding the GIL. The filter is valid as long as 'epoch' matches
+ * 'nb_internals::override_epoch'.
+ */
+struct override_table {
+    std::atomic<uint32_t> version;
+    std::atomic<size_t> size;
+    std::atomic<override_array *> array;
+    std::atomic<uint64_t> filter[override_filter_size];
+    std::atomic<size_t> epoch;
+};
+
+/// Hash function for the Bloom filter (64 bit FNV-1a)
+static uint64_t override_hash(const char *s, size_t len) noexcept {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < len; ++i)
+        h = (h ^ (uint8_t) s[i]) * 0x100000001b3ull;
+    return h;
+}
+
+/// Set the two filter bits associated with a hash value
+static void override_filter_add(uint64_t *filter, uint64_t h) noexcept {
+    for (int i = 0; i < 2; ++i, h >>= 32) {
+        uint32_t bit = (uint32_t) h % (override_filter_size * 64);
+        filter[bit / 64] |= (uint64_t) 1 << (bit % 64);
+    }
+}
+
+/// Could a Python class in the MRO define 'name'? Does not require the GIL
+static bool override_filter_check(const override_table *t,
+                                  const char *name) noexcept {
+    uint64_t h = override_hash(name, strlen(name));
+    for (int i = 0; i < 2; ++i, h >>= 32) {
+        uint32_t bit = (uint32_t) h % (override_filter_size * 64);
+        uint64_t word = t->filter[bit / 64].load(std::memory_order_relaxed);
+        if (!(word & ((uint64_t) 1 << (bit % 64))))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Compute the filter of names defined by Python classes in the MRO of 'tp'.
+ * Bound types only have a single base, hence all classes in the MRO other
+ * than 'object' are nanobind types whose modifications are observed by
+ * nb_type_setattro(). In case of an error, the filter is conservatively set
+ * to all ones.
+ */
+static void override_filter_compute(PyTypeObject *tp,
+                                    uint64_t *filter) noexcept {
+    memset(filter, 0, sizeof(uint64_t) * override_filter_size);
+
+    PyObject *mro = PyObject_GetAttrString((PyObject *) tp, "__mro__");
+    bool success = mro != nullptr;
+    Py_ssize_t n = success ? PyTuple_Size(mro) : 0;
+
+    for (Py_ssize_t i = 0; success && i < n; ++i) {
+        PyObject *cls = PyTuple_GetItem(mro, i);
+
+        // Methods of classes bound in C++ are never overrides
+        if (!nb_type_check(cls) ||
+            !(nb_type_data((PyTypeObject *) cls)->flags &
+              (uint32_t) type_flags::is_python_type))
+            continue;
+
+        PyObject *dict = PyObject_GetAttrString(cls, "__dict__"),
+                 *keys = dict ? PyMapping_Keys(dict) : nullptr;
+
+        if (keys) {
+            Py_ssize_t m = PyList_Size(keys);
+            for (Py_ssize_t j = 0; success && j < m; ++j) {
+                PyObject *key = PyList_GetItem(keys, j);
+                if (!PyUnicode_Check(key))
+                    continue;
+                Py_ssize_t len;
+                const char *s = PyUnicode_AsUTF8AndSize(key, &len);
+                if (s)
+                    override_filter_add(filter, override_hash(s, (size_t) len));
+                else
+                    success = false;
+            }
+        } else {
+            success = false;
+        }
+
+        Py_XDECREF(keys);
+        Py_XDECREF(dict);
+    }
+
+    Py_XDECREF(mro);
+
+    if (!success) {
+        PyErr_Clear();
+        memset(filter, 0xFF, sizeof(uint64_t) * override_filter_size);
+    }
+}
+
+static override_array *override_array_new(override_array *prev,
+                                          size_t capacity) noexcept {
+    void *p = malloc(sizeof(override_array) +
+                     (capacity - 1) * sizeof(override_entry));
+    if (!p)
+        fail("nanobind::detail::override_array_new(): out of memory!");
+
+    override_array *a = (override_array *) p;
+    a->prev = prev;
+    a->capacity = capacity;
+    for (size_t i = 0; i < capacity; ++i)
+        new (&a->entries[i]) override_entry();
+    return a;
+}
+
+void override_table_free(override_table *t) noexcept {
+    override_array *a = t->array.load(std::memory_order_relaxed);
+
+    while (a) {
+        override_array *prev = a->prev;
+        free(a);
+        a = prev;
+    }
+
+    internals->override_tables--;
+    delete t;
+}
+
+/**
+ * Recompute the filter of the table. When 'clear' is set, also discard the
+ * cached lookups. Neither requires any allocations.
+ */
+static void override_table_update(override_table *t, PyTypeObject *tp,
+                                  bool clear) noexcept {
+    size_t epoch = internals->override_epoch.load(std::memory_order_relaxed);
+    uint64_t filter[override_filter_size];
+    override_filter_compute(tp, filter);
+
+    t->version.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (clear)
+        t->size.store(0, std::memory_order_relaxed);
+    for (size_t i = 0; i < override_filter_size; ++i)
+        t->filter[i].store(filter[i], std::memory_order_relaxed);
+    t->epoch.store(epoch, std::memory_order_relaxed);
+
+    t->version.fetch_add(1, std::memory_order_release);
+}
+
+/// Discard the cached lookups of 'tp' and its subclasses
+static void override_table_clear(PyTypeObject *tp) noexcept {
+    if (!nb_type_check((PyObject *) tp))
+        return;
+
+    override_table *t = nb_type_data(tp)->overrides;
+    if (t)
+        override_table_update(t, tp, true);
+
+    // Python subclasses inherit the modified attribute
+    PyObject *subclasses =
+        PyObject_CallMethod((PyObject *) tp, "__subclasses__", nullptr);
+    if (!subclasses) {
+        PyErr_Clear();
+        return;
+    }
+
+    Py_ssize_t n = PyList_Size(subclasses);
+    for (Py_ssize_t i = 0; i < n; ++i)
+        override_table_clear((PyTypeObject *) PyList_GetItem(subclasses, i));
+
+    Py_DECREF(subclasses);
+}
+
+void override_invalidate(PyTypeObject *tp, PyObject *name) noexcept {
+    /* Only names that were looked up as virtual functions can have cached
+       entries, and they are rarely reassigned. Other assignments (e.g., of
+       class variables) merely advance the epoch, which makes all filters
+       stale. The filters are then recomputed lazily on the next miss. */
+    PyObject *names = internals->override_names;
+    int rv = names ? PyDict_Contains(names, name) : 0;
+    if (rv < 0) {
+        PyErr_Clear();
+        rv = 1;
+    }
+
+    if (rv == 0 && PyUnicode_Check(name) &&
+        PyUnicode_CompareWithASCIIString(name, "__bases__") == 0)
+        rv = 1;
+
+    if (rv)
+        override_table_clear(tp);
+
+    internals->override_epoch.fetch_add(1, std::memory_order_release);
+}
+
 void trampoline_new(void **data, size_t size, void *ptr) noexcept {
     // GIL is held when the trampoline constructor runs
     nb_ptr_map &inst_c2p = internals->inst_c2p;
@@ -21,123 +249,171 @@ void trampoline_new(void **data, size_t size, void *ptr) noexcept {
           "nanobind::detail::trampoline_new(): unique instance not found!");
 
     data[0] = it->second;
-    memset(data + 1, 0, sizeof(void *) * 2 * size);
-}
 
-void trampoline_release(void **data, size_t size) noexcept {
-    // GIL is held when the trampoline destructor runs
-    for (size_t i = 0; i < size; ++i)
-        Py_XDECREF((PyObject *) data[i*2 + 2]);
+    PyTypeObject *tp = Py_TYPE((PyObject *) data[0]);
+    type_data *td = nb_type_data(tp);
+    if (!td->overrides) {
+        override_table *t = new override_table();
+        t->version.store(0, std::memory_order_relaxed);
+        t->size.store(0, std::memory_order_relaxed);
+        t->array.store(override_array_new(nullptr, size ? size : 1),
+                       std::memory_order_relaxed);
+        override_table_update(t, tp, true);
+        td->overrides = t;
+        internals->override_tables++;
+    }
 }
 
-static void trampoline_enter_internal(void **data, size_t size,
-                                      const char *name, bool pure, ticket *t) {
-    const PyObject *None = Py_None;
-    PyGILState_STATE state{ };
-    const char *error = nullptr;
-    PyObject *key = nullptr, *value = nullptr;
-    PyTypeObject *value_tp = nullptr;
-    size_t offset = 0;
-
-    // First, perform a quick sweep without lock
-    for (size_t i = 0; i < size; i++) {
-        void *d_name  = data[2*i + 1],
-             *d_value = data[2*i + 2];
-        if (name == d_name && d_value) {
-            if (d_value != None) {
-                t->state = PyGILState_Ensure();
-                t->key = (PyObject *) d_value;
-                return;
-            } else {
-                if (pure) {
-                    error = "tried to call a pure virtual function";
-                    state = PyGILState_Ensure();
-                    goto fail;
-                } else {
-                    return;
-                }
-            }
+/// Look up a cached override, does not require the GIL
+static bool override_find(const type_data *td, const char *name,
+                          PyObject **key) noexcept {
+    const override_table *t = td->overrides;
+
+    uint32_t version = t->version.load(std::memory_order_acquire);
+    if (version & 1)
+        return false;
+
+    // Load 'size' first, the array is replaced before it grows beyond capacity
+    size_t size = t->size.load(std::memory_order_acquire);
+    override_array *a = t->array.load(std::memory_order_acquire);
+    bool found = false;
+
+    for (size_t i = 0; i < size; ++i) {
+        if (a->entries[i].name.load(std::memory_order_relaxed) == name) {
+            *key = a->entries[i].key.load(std::memory_order_relaxed);
+            found = true;
+            break;
         }
     }
 
-    // Nothing found -- retry, now with lock held
-    state = PyGILState_Ensure();
-    for (size_t i = 0; i < size; i++) {
-        void *d_name  = data[2*i + 1],
-             *d_value = data[2*i + 2];
-        if (name == d_name && d_value) {
-            if (d_value != None) {
-                t->state = state;
-                t->key = (PyObject *) d_value;
-                return;
-            } else {
-                if (pure) {
-                    error = "tried to call a pure virtual function";
-                    goto fail;
-                } else {
-                    PyGILState_Release(state);
-                    return;
-                }
-            }
-        }
+    // Virtual functions that no Python class defines are not overridden
+    if (!found &&
+        t->epoch.load(std::memory_order_relaxed) ==
+            internals->override_epoch.load(std::memory_order_acquire) &&
+        !override_filter_check(t, name)) {
+        *key = Py_None;
+        found = true;
     }
 
-    // Sill no luck -- perform a lookup and populate the trampoline
-    for (; offset < size; offset++) {
-        if (data[2 * offset + 1] == nullptr &&
-            data[2 * offset + 2] == nullptr)
-            break;
+    // Retry with the GIL held if the table was modified in the meantime
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return found && t->version.load(std::memory_order_relaxed) == version;
+}
+
+/// Look up an override and cache the result, requires the GIL
+static PyObject *override_lookup(type_data *td, const char *name,
+                                 const char **error) noexcept {
+    override_table *t = td->overrides;
+    PyTypeObject *tp = (PyTypeObject *) td->type_py;
+
+    if (t->epoch.load(std::memory_order_relaxed) !=
+        internals->override_epoch.load(std::memory_order_relaxed))
+        override_table_update(t, tp, false);
+
+    override_array *a = t->array.load(std::memory_order_relaxed);
+    size_t size = t->size.load(std::memory_order_relaxed);
+
+    // Another thread may have performed the lookup in the meantime
+    for (size_t i = 0; i < size; ++i) {
+        if (a->entries[i].name.load(std::memory_order_relaxed) == name)
+            return a->entries[i].key.load(std::memory_order_relaxed);
     }
 
-    if (offset == size) {
-        error = "the trampoline ran out of slots (you will need to increase "
-                "the value provided to the NB_TRAMPOLINE() macro)";
-        goto fail;
+    /* The 'override_names' dictionary owns the interned names, hence cached
+       entries and tickets can refer to them without reference counting */
+    PyObject *names = internals->override_names;
+    if (!names) {
+        names = internals->override_names = PyDict_New();
+        if (!names) {
+            *error = "could not create dictionary";
+            return nullptr;
+        }
     }
 
-    key = PyUnicode_InternFromString(name);
+    PyObject *key = PyUnicode_InternFromString(name), *value = nullptr;
+    if (key) {
+        PyObject *key2 = PyDict_SetDefault(names, key, key);
+        Py_DECREF(key);
+        key = key2;
+    }
     if (!key) {
-        error = "could not intern string";
-        goto fail;
+        *error = "could not intern string";
+        return nullptr;
     }
 
-    value = PyObject_GetAttr((PyObject *) data[0], key);
+    /* Look up the override on the type, since the result is shared by all
+       instances. Attributes of individual instances are deliberately
+       ignored, even on the first call, so that the outcome does not depend
+       on the state of the cache. */
+    value = PyObject_GetAttr((PyObject *) tp, key);
     if (!value) {
-        error = "lookup failed";
-        goto fail;
+        *error = "lookup failed";
+        return nullptr;
     }
 
-    value_tp = Py_TYPE(value);
-    Py_CLEAR(value);
+    PyTypeObject *value_tp = Py_TYPE(value);
+    Py_DECREF(value);
 
     if (value_tp == internals->nb_func || value_tp == internals->nb_method ||
-        value_tp == internals->nb_bound_method) {
-        Py_DECREF(key);
+        value_tp == internals->nb_bound_method)
+        key = Py_None;
 
-        if (pure) {
-            error = "tried to call a pure virtual function";
-            goto fail;
+    if (size == a->capacity) {
+        override_array *a2 = override_array_new(a, a->capacity * 2);
+        for (size_t i = 0; i < size; ++i) {
+            a2->entries[i].name.store(
+                a->entries[i].name.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+            a2->entries[i].key.store(
+                a->entries[i].key.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
         }
-
-        Py_INCREF(Py_None);
-        key = Py_None;
+        t->array.store(a2, std::memory_order_release);
+        a = a2;
     }
 
-    data[2 * offset + 1] = (void *) name;
-    data[2 * offset + 2] = key;
+    a->entries[size].name.store(name, std::memory_order_relaxed);
+    a->entries[size].key.store(key, std::memory_order_relaxed);
+    t->size.store(size + 1, std::memory_order_release);
 
-    if (key != None) {
-        t->state = state;
-        t->key = key;
-        return;
-    } else {
-        PyGILState_Release(state);
+    return key;
+}
+
+static void trampoline_enter_internal(void **data, const char *name,
+                                      bool pure, ticket *t) {
+    type_data *td = nb_type_data(Py_TYPE((PyObject *) data[0]));
+    PyGILState_STATE state{ };
+    const char *error = nullptr;
+    PyObject *key = nullptr;
+    bool locked = false;
+
+    // First, perform a quick lookup without lock
+    if (!override_find(td, name, &key)) {
+        // Nothing found -- perform the lookup with lock held
+        state = PyGILState_Ensure();
+        locked = true;
+        key = override_lookup(td, name, &error);
+        if (!key)
+            goto fail;
+    }
+
+    if (key == Py_None) {
+        if (pure) {
+            error = "tried to call a pure virtual function";
+            goto fail;
+        }
+        if (locked)
+            PyGILState_Release(state);
         return;
     }
 
+    t->state = locked ? state : PyGILState_Ensure();
+    t->key = key;
+    return;
+
 fail:
-    type_data *td = nb_type_data(Py_TYPE((PyObject *) data[0]));
-    PyGILState_Release(state);
+    if (locked)
+        PyGILState_Release(state);
 
     raise("nanobind::detail::get_trampoline('%s::%s()'): %s!",
           td->name, name, error);
@@ -145,8 +421,8 @@ fail:
 
 NB_THREAD_LOCAL ticket *current_ticket = nullptr;
 
-void trampoline_enter(void **data, size_t size, const char *name, bool pure, ticket *t) {
-    trampoline_enter_internal(data, size, name, pure, t);
+void trampoline_enter(void **data, size_t, const char *name, bool pure, ticket *t) {
+    trampoline_enter_internal(data, name, pure, t);
 
     if (t->key) {
         t->self = (PyObject *) data[0];
@@ -76,6 +76,13 @@ NB_MODULE(test_chrono_ext, m) {
     m.def("test_nano_timepoint_diff",
           [](timestamp start, timestamp end) -> timespan { return start - end; });
 
+    // Vectors of time points, which also accept NumPy datetime64 arrays
+    m.def("test_chrono_vector", [](std::vector<system_time> v) { return v; });
+
+    m.def("test_chrono_datetime64", [](const std::vector<timestamp> &v) {
+        return nanobind::datetime64_array(v);
+    });
+
     // Test different resolutions
     nanobind::class_<different_resolutions>(m, "different_resolutions")
         .def(nanobind::init<>())
@@ -336,3 +336,58 @@ def test_chrono_invalid(test_type, roundtrip):
                     roundtrip(fake_val)
                 assert cm.unraisable is not None
                 assert errtype in repr(cm.unraisable.exc_value)
+
+
+def test_chrono_vector():
+    dates = [
+        datetime.datetime(2023, 1, 2, 3, 4, 5, 123456),
+        datetime.datetime(1999, 12, 31, 23, 59, 59),
+    ]
+    assert m.test_chrono_vector(dates) == dates
+    assert m.test_chrono_vector(tuple(dates)) == dates
+    assert m.test_chrono_vector([]) == []
+
+
+def test_chrono_datetime64():
+    np = pytest.importorskip("numpy")
+
+    a = np.array(
+        ["2023-01-02T03:04:05.123456789", "1969-12-31T23:59:59", "2262-01-01"],
+        dtype="datetime64[ns]",
+    )
+    b = m.test_chrono_datetime64(a)
+    assert b.dtype == np.dtype("datetime64[ns]")
+    assert np.all(a == b)
+
+    # Other time units and non-contiguous arrays are converted in bulk
+    s = a.astype("datetime64[s]")
+    assert np.all(m.test_chrono_datetime64(s) == s)
+    assert np.all(m.test_chrono_datetime64(a[::-2]) == a[::-2])
+    assert m.test_chrono_datetime64(a[:0]).shape == (0,)
+
+    # Multidimensional arrays are not supported
+    with pytest.raises(TypeError):
+        m.test_chrono_datetime64(a.reshape(1, 3))
+
+    # Other vectors of time points accept datetime64 arrays as well
+    assert len(m.test_chrono_vector(a)) == 3
+
+
+@pytest.mark.parametrize(
+    "tz",
+    [
+        None,
+        pytest.param("Europe/Brussels", marks=SKIP_TZ_ENV_ON_WIN),
+        pytest.param("America/New_York", marks=SKIP_TZ_ENV_ON_WIN),
+    ],
+)
+def test_chrono_datetime64_local_time(tz, monkeypatch):
+    np = pytest.importorskip("numpy")
+    if tz is not None:
+        monkeypatch.setenv("TZ", f"/usr/share/zoneinfo/{tz}")
+
+    # datetime64 values and datetime objects denote the same local time
+    d = [datetime.datetime(2023, 6, 1, 12, 30), datetime.datetime(1999, 12, 31)]
+    a = np.array(d, dtype="datetime64[us]")
+    assert m.test_chrono_vector(a) == d
+    assert np.all(m.test_chrono_datetime64(d) == a)
@@ -181,7 +181,8 @@ NB_MODULE(test_classes_ext, m) {
     // test10_trampoline_failures
 
     struct PyAnimal : Animal {
-        NB_TRAMPOLINE(Animal, 3);
+        // Fewer than the number of overrides to test growth of the cache
+        NB_TRAMPOLINE(Animal, 1);
 
         PyAnimal() {
             default_constructed++;
@@ -741,3 +741,68 @@ def test41_implicit_conversion_keep_alive():
     assert d1 == []
     assert d2 == [5]
     assert d3 == [106, 6]
+
+
+def test42_trampoline_override_cache():
+    class Parrot(t.Animal):
+        def what(self):
+            return "squawk"
+
+    p1, p2 = Parrot(), Parrot()
+    assert t.go(p1) == 'Animal says squawk'
+    assert t.go(p2) == 'Animal says squawk'
+
+    # Overrides are looked up on the type, instance attributes are ignored
+    p3 = Parrot()
+    p3.name = lambda: "Polly"
+    assert t.go(p3) == 'Animal says squawk'
+
+    # Modifying the type invalidates cached lookups of all instances
+    Parrot.name = lambda self: "Polly"
+    assert t.go(p1) == 'Polly says squawk'
+    assert t.go(p2) == 'Polly says squawk'
+    assert t.go(Parrot()) == 'Polly says squawk'
+
+    del Parrot.name
+    assert t.go(p1) == 'Animal says squawk'
+    assert t.go(p2) == 'Animal says squawk'
+
+    # .. and of instances of Python subclasses
+    class Macaw(Parrot):
+        pass
+
+    m = Macaw()
+    assert t.go(m) == 'Animal says squawk'
+    Parrot.name = lambda self: "Polly"
+    assert t.go(m) == 'Polly says squawk'
+    Macaw.what = lambda self: "hello"
+    assert t.go(m) == 'Polly says hello'
+    assert t.go(p1) == 'Polly says squawk'
+
+
+def test43_trampoline_override_class_vars():
+    # Assigning class variables leaves cached lookups intact
+    class Parrot(t.Animal):
+        counter = 0
+
+        def what(self):
+            return "squawk"
+
+    p = Parrot()
+    for i in range(100):
+        Parrot.counter += 1
+        assert t.go(p) == 'Animal says squawk'
+    assert Parrot.counter == 100
+
+    # .. while assigning virtual functions still invalidates them
+    Parrot.name = lambda self: "Polly"
+    assert t.go(p) == 'Polly says squawk'
+
+    # Python base classes that don't derive from a bound type could be
+    # modified without invalidating the table, but they are rejected
+    class Mixin:
+        pass
+
+    with pytest.raises(RuntimeError, match='invalid number of bases'):
+        class Canary(Mixin, t.Animal):
+            pass
@@ -27,6 +27,11 @@ def test01_unsigned_enum():
     assert t.to_enum(0) == t.Enum.A
     assert t.to_enum(1) == t.Enum.B
     assert t.to_enum(0xffffffff) == t.Enum.C
+    assert t.to_enum(0) is t.Enum.A
+    assert t.to_enum(0xffffffff) is t.Enum.C
+    assert t.new_enum(1) is t.Enum.B
+    assert t.new_enum(2) == 2 and t.new_enum(2) is not t.new_enum(2)
+    assert t.ref_enum() == t.Enum.B and t.ref_enum() is not t.Enum.B
     assert hash(t.Enum.A) == 0
     assert hash(t.Enum.B) == 1
     assert hash(t.Enum.C) == -2 # -1 is an invalid hash value.
@@ -40,6 +45,10 @@ def test01_unsigned_enum():
         t.Enum(0x123)
     assert 'test_enum_ext.Enum(): could not convert the input into an enumeration value!' in str(excinfo.value)
 
+    for value in (-1, 2**32, 2**64):
+        with pytest.raises(RuntimeError):
+            t.Enum(value)
+
 
 def test02_signed_enum():
     assert repr(t.SEnum.A) == 'test_enum_ext.SEnum.A'
@@ -54,6 +63,13 @@ def test02_signed_enum():
     assert t.from_enum(t.SEnum.A) == 0
     assert t.from_enum(t.SEnum.B) == 1
     assert t.from_enum(t.SEnum.C) == -1
+    assert t.to_senum(-1) is t.SEnum.C
+    assert t.to_senum(1).__name__ == 'B'
+    with pytest.raises(RuntimeError):
+        t.to_senum(2).__name__
+    for value in (2, 2**31, -2**31 - 1):
+        with pytest.raises(RuntimeError):
+            t.SEnum(value)
     assert hash(t.SEnum.A) == 0
     assert hash(t.SEnum.B) == 1
     assert hash(t.SEnum.C) == -2 # -1 is an invalid hash value.
@@ -147,3 +163,43 @@ def test08_enum_comparisons():
     assert t.SEnum.B > t.Enum.A
     assert t.Enum.A <= t.SEnum.A and t.Enum.A >= t.SEnum.A
     assert t.Enum.A != t.SEnum.A
+
+
+def test09_flag_enum():
+    F = t.Flags
+    rw = F.Read | F.Write
+    assert type(rw) is F
+    assert repr(rw) == 'test_enum_ext.Flags.Read|Write'
+    assert rw.__name__ == 'Read|Write'
+    assert int(rw) == 3 and t.from_flags(rw) == 3
+
+    # Composite values of defined bits are created once and cached
+    assert F.Write | F.Read is rw
+    assert t.to_flags(3) is rw
+    assert F(3) is rw
+    assert (F.All & ~F.Exec) is rw
+    assert (rw ^ F.Write) is F.Read
+    assert F.Read | F.Write | F.Exec is F.All
+    assert F.All & F.Exec is F.Exec
+    assert rw.__doc__ is None
+    assert repr(t.to_flags(0x18)) == 'test_enum_ext.Flags.0x18'
+    assert repr(t.to_flags(0x12)) == 'test_enum_ext.Flags.Write|0x10'
+
+    # .. while values with undefined bits are not cached, but compare equal
+    assert t.to_flags(0x12) == t.to_flags(0x12)
+    assert t.to_flags(0x12) is not t.to_flags(0x12)
+    assert hash(t.to_flags(0x12)) == hash(F(0x12))
+
+    # Like enum.Flag, the complement only contains defined bits
+    assert repr(~F.Read) == 'test_enum_ext.Flags.Write|Exec'
+    assert int(~F.Read) == 6
+    assert ~F.Empty is F.All and ~F.All is F.Empty
+
+    assert bool(F.Read) and not F.Empty
+    assert not (rw & F.Exec)
+
+    # Other operands are only supported by arithmetic enums
+    with pytest.raises(TypeError):
+        F.Read | 1
+    with pytest.raises(TypeError):
+        F.Read | t.Enum.A
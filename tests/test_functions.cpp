@@ -1,6 +1,7 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/stl/pair.h>
 #include <nanobind/stl/string.h>
+#include <vector>
 
 namespace nb = nanobind;
 using namespace nb::literals;
@@ -14,6 +15,14 @@ struct my_call_guard {
 
 int test_31(int i) noexcept { return i; }
 
+/// Byte container that counts live instances (used by the owned_buffer test)
+struct counted_bytes : std::vector<uint8_t> {
+    static inline int alive = 0;
+    counted_bytes(size_t n) : std::vector<uint8_t>(n) { alive++; }
+    counted_bytes(counted_bytes &&v) : std::vector<uint8_t>(std::move(v)) { alive++; }
+    ~counted_bytes() { alive--; }
+};
+
 NB_MODULE(test_functions_ext, m) {
     m.doc() = "function testcase";
 
@@ -239,4 +248,17 @@ NB_MODULE(test_functions_ext, m) {
 
     m.def("test_del_list", [](nb::list l) { nb::del(l[2]); });
     m.def("test_del_dict", [](nb::dict l) { nb::del(l["a"]); });
+
+    m.def("test_owned_buffer_str", []() {
+        return nb::owned_buffer(std::string("hello"));
+    });
+
+    m.def("test_owned_buffer_vec", [](size_t n, bool writable) {
+        counted_bytes v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = (uint8_t) i;
+        return nb::owned_buffer(std::move(v), writable);
+    });
+
+    m.def("test_owned_buffer_alive", []() { return counted_bytes::alive; });
 }
@@ -348,3 +348,33 @@ def test39_del():
 
     with pytest.raises(KeyError):
         t.test_del_dict({})
+
+
+def test40_owned_buffer():
+    m = t.test_owned_buffer_str()
+    assert isinstance(m, memoryview) and m.readonly
+    assert bytes(m) == b"hello"
+
+    m = t.test_owned_buffer_vec(1000, False)
+    assert m.readonly and len(m) == 1000
+    assert m[999] == 999 % 256
+    with pytest.raises(TypeError):
+        m[0] = 1
+    assert t.test_owned_buffer_alive() == 1
+
+    # Derived views keep the container alive
+    m2 = m[10:20]
+    del m
+    assert t.test_owned_buffer_alive() == 1
+    assert m2.tobytes() == bytes(range(10, 20))
+    del m2
+    assert t.test_owned_buffer_alive() == 0
+
+    m = t.test_owned_buffer_vec(4, True)
+    assert not m.readonly
+    m[0] = 42
+    assert bytearray(m) == bytearray([42, 1, 2, 3])
+    del m
+    assert t.test_owned_buffer_alive() == 0
+
+    assert len(t.test_owned_buffer_vec(0, False)) == 0
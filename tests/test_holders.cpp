@@ -89,6 +89,10 @@ NB_MODULE(test_holders_ext, m) {
           [](std::shared_ptr<Example> shared) { return shared; });
     m.def("passthrough_2",
           [](std::shared_ptr<const Example> shared) { return shared; });
+    m.def("same_owner",
+          [](std::shared_ptr<Example> a, std::shared_ptr<const Example> b) {
+              return !a.owner_before(b) && !b.owner_before(a);
+          });
 
     // ------- enable_shared_from_this -------
 
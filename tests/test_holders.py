@@ -365,3 +365,27 @@ def test14_nullable_properties():
     assert a.value_nullable is None
     with pytest.raises(TypeError):
         a.value = None
+
+
+def test15_sharedptr_control_block(clean):
+    # Repeated conversions of the same instance share a control block
+    e1, e2 = t.Example(1), t.Example(2)
+    assert t.same_owner(e1, e1)
+    assert not t.same_owner(e1, e2)
+
+    w = t.SharedWrapper(e1)
+    assert t.same_owner(e1, w.ptr)
+    del e1, w
+    collect()
+    assert t.stats() == (2, 1)
+
+    # .. and a new one is created once the previous one expired
+    assert t.same_owner(e2, e2)
+    w1 = t.SharedWrapper(e2)
+    w2 = t.SharedWrapper(e2)
+    del w1
+    collect()
+    assert w2.ptr is e2
+    del e2, w2
+    collect()
+    assert t.stats() == (2, 2)
@@ -3,6 +3,7 @@
 #include <nanobind/trampoline.h>
 #include <nanobind/intrusive/counter.h>
 #include <nanobind/intrusive/ref.h>
+#include <thread>
 
 namespace nb = nanobind;
 using namespace nb::literals;
@@ -36,8 +37,7 @@ NB_MODULE(test_intrusive_ext, m) {
             Py_INCREF(o);
         },
         [](PyObject *o) noexcept {
-            nb::gil_scoped_acquire guard;
-            Py_DECREF(o);
+            nb::dec_ref_deferred(o);
         });
 
     nb::class_<nb::intrusive_base>(
@@ -63,4 +63,22 @@ NB_MODULE(test_intrusive_ext, m) {
     m.def("get_value_1", [](Test *o) { nb::ref<Test> x(o); return x->value(1); });
     m.def("get_value_2", [](nb::ref<Test> x) { return x->value(2); });
     m.def("get_value_3", [](const nb::ref<Test> &x) { return x->value(3); });
+
+    m.def("release_in_thread", [](Test *o) {
+        // Returns the number of references that are still pending release
+        PyObject *self = nb::find(o).ptr();
+        Py_ssize_t rc = Py_REFCNT(self);
+        nb::ref<Test> x(o);
+        {
+            nb::gil_scoped_release guard;
+            std::thread([x = std::move(x)]() mutable { x = nullptr; }).join();
+        }
+        return Py_REFCNT(self) - rc;
+    });
+
+#if defined(Py_LIMITED_API)
+    m.attr("deferred_decref") = false;
+#else
+    m.attr("deferred_decref") = true;
+#endif
 }
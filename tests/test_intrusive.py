@@ -1,6 +1,7 @@
 import test_intrusive_ext as t
 import pytest
-from common import collect
+import sys
+from common import collect, is_pypy
 
 @pytest.fixture
 def clean():
@@ -56,3 +57,20 @@ def test04_subclass(clean):
     del o
     collect()
     assert t.stats() == (1, 1)
+
+
+def test05_release_in_thread(clean):
+    # The worker thread does not hold the GIL and queues the decref
+    o = t.Test()
+    rc = sys.getrefcount(o) if not is_pypy else 0
+    assert t.release_in_thread(o) == (1 if t.deferred_decref else 0)
+
+    # The next call of a bound function drains the queue (if the interpreter
+    # hasn't already done so via a pending call)
+    t.stats()
+    if not is_pypy:
+        assert sys.getrefcount(o) == rc
+
+    del o
+    collect()
+    assert t.stats() == (1, 1)
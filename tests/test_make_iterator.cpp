@@ -1,6 +1,8 @@
 #include <nanobind/make_iterator.h>
 #include <nanobind/stl/unordered_map.h>
 #include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+#include <nanobind/ndarray.h>
 
 namespace nb = nanobind;
 
@@ -35,6 +37,31 @@ NB_MODULE(test_make_iterator_ext, m) {
                                            map.end());
         }, nb::keep_alive<0, 1>());
 
+    struct IntVec {
+        std::vector<int> v;
+    };
+
+    nb::class_<IntVec>(m, "IntVec")
+        .def(nb::init<std::vector<int>>())
+        .def("__iter__",
+             [](const IntVec &iv) {
+                 return nb::make_iterator(nb::type<IntVec>(), "iterator",
+                                          iv.v.begin(), iv.v.end());
+             }, nb::keep_alive<0, 1>())
+        .def("chunks",
+             [](const IntVec &iv, size_t chunk_size) {
+                 return nb::make_chunk_iterator(nb::type<IntVec>(),
+                                                "chunk_iterator", iv.v,
+                                                chunk_size);
+             }, nb::keep_alive<0, 1>())
+        .def("array_chunks",
+             [](const IntVec &iv, size_t chunk_size) {
+                 using Array = nb::ndarray<nb::numpy, int, nb::ndim<1>>;
+                 return nb::make_chunk_iterator<Array>(
+                     nb::type<IntVec>(), "array_chunk_iterator", iv.v,
+                     chunk_size);
+             }, nb::keep_alive<0, 1>());
+
     nb::handle mod = m;
     m.def("iterator_passthrough", [mod](nb::iterator s) -> nb::iterator {
         return nb::make_iterator(mod, "pt_iterator", std::begin(s), std::end(s));
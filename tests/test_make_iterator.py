@@ -33,3 +33,64 @@ def test04_passthrough_iterator():
     for d in data:
         m = t.StringMap(d)
         assert list(t.iterator_passthrough(m.values())) == list(m.values())
+
+
+def test05_native_iternext():
+    m = t.StringMap({'a': 'b'})
+    it = m.values()
+    assert iter(it) is it
+    assert type(it).__next__ is not None
+    assert next(it) == 'b'
+    for _ in range(2):
+        with pytest.raises(StopIteration):
+            next(it)
+
+
+def test06_iterator_exception():
+    def gen():
+        yield 1
+        raise ValueError('oops')
+
+    it = t.iterator_passthrough(gen())
+    assert next(it) == 1
+    with pytest.raises(ValueError, match='oops'):
+        next(it)
+
+
+def test07_length_hint():
+    import operator
+    v = t.IntVec([1, 2, 3])
+    it = iter(v)
+    assert operator.length_hint(it) == 3
+    next(it)
+    assert operator.length_hint(it) == 2
+    assert list(it) == [2, 3]
+    assert operator.length_hint(it) == 0
+
+    # No length hint without random access
+    assert not hasattr(t.StringMap().values(), '__length_hint__')
+
+
+def test08_chunks():
+    import operator
+    v = t.IntVec(list(range(7)))
+    it = v.chunks(3)
+    assert operator.length_hint(it) == 3
+    assert list(it) == [[0, 1, 2], [3, 4, 5], [6]]
+    assert operator.length_hint(it) == 0
+    assert list(t.IntVec([]).chunks(2)) == []
+    with pytest.raises(ValueError, match='chunk size'):
+        v.chunks(0)
+
+
+def test09_array_chunks():
+    try:
+        import numpy as np
+    except ImportError:
+        pytest.skip('numpy is missing')
+    v = t.IntVec(list(range(5)))
+    chunks = list(v.array_chunks(2))
+    assert len(chunks) == 3
+    assert all(isinstance(c, np.ndarray) and c.dtype == np.int32 for c in chunks)
+    assert np.array_equal(np.concatenate(chunks), np.arange(5))
+    assert chunks[2].shape == (1,)
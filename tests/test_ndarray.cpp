@@ -1,6 +1,7 @@
 #include <nanobind/nanobind.h>
 #include <nanobind/ndarray.h>
 #include <nanobind/stl/complex.h>
+#include <nanobind/stl/string.h>
 #include <algorithm>
 #include <vector>
 
@@ -219,6 +220,7 @@ NB_MODULE(test_ndarray_ext, m) {
         auto f1() { return nb::ndarray<nb::numpy, float>(data, { 10 }); }
         auto f2() { return nb::ndarray<nb::numpy, float>(data, { 10 }, nb::cast(this, nb::rv_policy::none)); }
         auto f3(nb::handle owner) { return nb::ndarray<nb::numpy, float>(data, { 10 }, owner); }
+        auto f4() { return f1().slice(0, 2, 5); }
 
         ~Cls() {
            destruct_count++;
@@ -233,7 +235,8 @@ NB_MODULE(test_ndarray_ext, m) {
         .def("f2", &Cls::f2)
         .def("f1_ri", &Cls::f1, nb::rv_policy::reference_internal)
         .def("f2_ri", &Cls::f2, nb::rv_policy::reference_internal)
-        .def("f3_ri", &Cls::f3, nb::rv_policy::reference_internal);
+        .def("f3_ri", &Cls::f3, nb::rv_policy::reference_internal)
+        .def("f4_ri", &Cls::f4, nb::rv_policy::reference_internal);
 
     m.def("fill_view_1", [](nb::ndarray<> x) {
         if (x.ndim() == 2 && x.dtype() == nb::dtype<float>()) {
@@ -287,6 +290,184 @@ NB_MODULE(test_ndarray_ext, m) {
     });
 #endif
 
+    m.def("nditer_add", [](nb::ndarray<const float, nb::device::cpu> a,
+                           nb::ndarray<const float, nb::device::cpu> b,
+                           nb::ndarray<float, nb::device::cpu> out) {
+        size_t calls = 0;
+        nb::nditer([&](void **p, const int64_t *s, size_t n) {
+            const uint8_t *pa = (const uint8_t *) p[0],
+                          *pb = (const uint8_t *) p[1];
+            uint8_t *po = (uint8_t *) p[2];
+            for (size_t i = 0; i < n; ++i)
+                *(float *) (po + i * s[2]) = *(const float *) (pa + i * s[0]) +
+                                             *(const float *) (pb + i * s[1]);
+            calls++;
+        }, a, b, out);
+        return calls;
+    }, "a"_a.noconvert(), "b"_a.noconvert(), "out"_a.noconvert());
+
+    m.def("nditer_cuda", []() {
+        // Never dereferenced, operands on other devices are rejected
+        float value = 0.f;
+        size_t shape[1] = { 1 };
+        nb::ndarray<float, nb::device::cuda> a(&value, 1, shape, nb::handle(),
+                                               nullptr, nb::dtype<float>(),
+                                               nb::device::cuda::value);
+        nb::nditer([](void **, const int64_t *, size_t) { }, a);
+    });
+
+    m.def("ret_empty", [](size_t n, bool huge_pages) {
+        return nb::ndarray<nb::numpy, float, nb::ndim<2>>::empty({ n, 3 }, huge_pages);
+    }, "n"_a, "huge_pages"_a = false);
+
+    m.def("ret_zeros", [](size_t n) {
+        return nb::ndarray<nb::numpy, double, nb::ndim<2>>::zeros({ n, 3 });
+    });
+
+    m.def("ret_zeros_mismatch", [](size_t n) {
+        return nb::ndarray<nb::numpy, float, nb::shape<nb::any, 3>>::zeros({ n });
+    });
+
+    m.def("ret_zeros_shape", [](size_t n, size_t m) {
+        return nb::ndarray<nb::numpy, float, nb::shape<nb::any, 3>>::zeros({ n, m });
+    });
+
+    m.def("ret_zeros_f", [](size_t n) {
+        auto a = nb::ndarray<nb::numpy, int32_t, nb::ndim<2>, nb::f_contig>::zeros({ n, 3 });
+        for (size_t i = 0; i < a.shape(0); ++i)
+            for (size_t j = 0; j < a.shape(1); ++j)
+                a(i, j) = (int32_t) (i * 10 + j);
+        return a;
+    });
+
+    m.def("map_file_ro", [](const std::string &fname, size_t n, uint64_t offset) {
+        return nb::ndarray<nb::numpy, const float, nb::ndim<2>>::map_file(
+            fname.c_str(), { n, 2 }, offset, nb::mmap_advice::sequential);
+    });
+
+    m.def("map_file_mismatch", [](const std::string &fname, size_t n) {
+        return nb::ndarray<nb::numpy, const float, nb::ndim<2>>::map_file(
+            fname.c_str(), { n });
+    });
+
+    m.def("map_file_shape", [](const std::string &fname) {
+        return nb::ndarray<nb::numpy, const float, nb::shape<4>>::map_file(
+            fname.c_str());
+    });
+
+    m.def("map_file_cow", [](const std::string &fname) {
+        auto a = nb::ndarray<nb::numpy, float, nb::ndim<1>>::map_file(
+            fname.c_str(), 0, nb::mmap_advice::willneed);
+        if (a.shape(0) > 0)
+            a(0) = -1.f;
+        return a;
+    });
+
+    m.def("half_sum", [](nb::ndarray<const nb::half, nb::ndim<1>, nb::device::cpu> x) {
+        float sum = 0.f;
+        for (size_t i = 0; i < x.shape(0); ++i)
+            sum += (float) x(i);
+        return sum;
+    }, "x"_a);
+
+    m.def("ret_half", [](size_t n) {
+        auto a = nb::ndarray<nb::numpy, nb::half, nb::ndim<1>>::empty({ n });
+        for (size_t i = 0; i < n; ++i)
+            a(i) = nb::half(i * 0.5f);
+        return a;
+    });
+
+    m.def("bfloat16_scale", [](nb::ndarray<const nb::bfloat16, nb::ndim<1>, nb::device::cpu> x,
+                               float s) {
+        auto a = nb::ndarray<nb::numpy, nb::bfloat16, nb::ndim<1>>::empty({ x.shape(0) });
+        for (size_t i = 0; i < x.shape(0); ++i)
+            a(i) = nb::bfloat16((float) x(i) * s);
+        return a;
+    }, "x"_a, "s"_a);
+
+    m.def("complex_sum", [](nb::ndarray<const std::complex<float>, nb::ndim<1>, nb::device::cpu> x) {
+        std::complex<float> sum = 0.f;
+        for (size_t i = 0; i < x.shape(0); ++i)
+            sum += x(i);
+        return sum;
+    }, "x"_a);
+
+    m.def("ret_float4", []() {
+        nb::dlpack::dtype dt = nb::dtype<float>();
+        dt.lanes = 4;
+        return nb::ndarray<nb::numpy>(f_global, { 2 }, nb::handle(), { }, dt);
+    });
+
+    using Array2f = nb::ndarray<nb::numpy, float, nb::ndim<2>>;
+    using Array1f = nb::ndarray<nb::numpy, float, nb::ndim<1>>;
+
+    static_assert(std::is_same_v<decltype(std::declval<Array2f>().select(0, 0)),
+                                 nb::ndarray<nb::numpy, float>>);
+    static_assert(std::is_same_v<
+        decltype(std::declval<nb::ndarray<nb::c_contig, float, nb::shape<2, 3>>>().transpose()),
+        nb::ndarray<float>>);
+
+    m.def("view_batches", [](Array2f a, size_t size) {
+        nb::list l;
+        for (size_t i = 0; i < a.shape(0); i += size)
+            l.append(a.slice(0, (int64_t) i, (int64_t) (i + size)));
+        return l;
+    });
+
+    m.def("view_slice", [](Array2f a, size_t axis, int64_t start, int64_t stop,
+                           int64_t step) {
+        return a.slice(axis, start, stop, step);
+    });
+
+    m.def("view_select", [](Array2f a, size_t axis, int64_t index) {
+        return Array1f(a.select(axis, index));
+    });
+
+    m.def("view_transpose", [](Array2f a) { return a.transpose(); });
+
+    m.def("view_reshape", [](Array2f a, size_t n) {
+        return Array1f(a.reshape({ n }));
+    });
+
+    m.def("view_of_zeros", []() {
+        Array2f a = Array2f::zeros({ 4, 3 });
+        a(2, 1) = 5.f;
+        return Array1f(a.transpose().select(0, 1).slice(0, 1, 3));
+    });
+
+    m.def("ret_array_vec", [](size_t n) {
+        std::vector<double> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = (double) i * 0.5;
+        return v;
+    }, nb::ret_array<>());
+
+    m.def("ret_array_std_array", []() {
+        return std::array<int16_t, 3>{ 1, -2, 3 };
+    }, nb::ret_array<nb::numpy>());
+
+    m.def("ret_array_vec3", [](size_t n) {
+        std::vector<std::array<float, 3>> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = { (float) i, 0.f, -(float) i };
+        return v;
+    }, nb::ret_array<>());
+
+    m.def("ret_array_nested", [](size_t rows, size_t cols, bool ragged) {
+        std::vector<std::vector<int>> v(rows, std::vector<int>(cols));
+        for (size_t i = 0; i < rows; ++i)
+            for (size_t j = 0; j < cols; ++j)
+                v[i][j] = (int) (i * cols + j);
+        if (ragged)
+            v.back().push_back(0);
+        return v;
+    }, nb::ret_array<>());
+
+    static std::vector<uint8_t> ret_array_global { 1, 2, 3 };
+    m.def("ret_array_ref", []() -> const std::vector<uint8_t> & {
+        return ret_array_global;
+    }, nb::ret_array<>());
+
     m.def("cast", [](bool b) -> nb::ndarray<nb::numpy> {
         using Ret = nb::ndarray<nb::numpy>;
         if (b)
@@ -540,6 +540,20 @@ def test28_reference_internal():
         dc += 1
         assert t.destruct_count() == dc
 
+    # Views returned with 'reference_internal' keep their parent alive
+    c4 = t.Cls()
+    v4 = c4.f4_ri()
+    assert np.all(v4 == [2, 3, 4])
+    v4[0] = -1
+    assert c4.f1_ri()[2] == -1
+    del c4
+    collect()
+    assert t.destruct_count() == dc
+    del v4
+    collect()
+    dc += 1
+    assert t.destruct_count() == dc
+
     c3 = t.Cls()
     c3_t = (c3,)
     with pytest.raises(RuntimeError) as excinfo:
@@ -624,3 +638,233 @@ def test34_complex_decompose():
 
     assert np.all(x1.real == np.array([1, 3, 5], dtype=np.float32))
     assert np.all(x1.imag == np.array([2, 4, 6], dtype=np.float32))
+
+@needs_numpy
+def test35_nditer():
+    a = np.arange(12, dtype=np.float32).reshape(3, 4)
+    b = np.arange(4, dtype=np.float32)
+    out = np.zeros((3, 4), dtype=np.float32)
+
+    # Contiguous operands are coalesced into a single inner loop
+    assert t.nditer_add(a, a, out) == 1
+    assert np.all(out == a + a)
+
+    # Broadcasting along the outer dimension
+    assert t.nditer_add(a, b, out) == 3
+    assert np.all(out == a + b)
+
+    # Broadcasting along the inner dimension
+    c = np.arange(3, dtype=np.float32).reshape(3, 1)
+    t.nditer_add(a, c, out)
+    assert np.all(out == a + c)
+
+    # Fortran-ordered operands are also iterated contiguously
+    af = np.asfortranarray(a)
+    of = np.zeros((3, 4), dtype=np.float32, order='F')
+    assert t.nditer_add(af, af, of) == 1
+    assert np.all(of == a + a)
+
+    # Strided and reversed views
+    d = np.arange(48, dtype=np.float32).reshape(6, 8)[::2, ::-2]
+    t.nditer_add(d, a, out)
+    assert np.all(out == d + a)
+
+    # 0-dimensional and empty operands
+    s = np.array(2, dtype=np.float32)
+    t.nditer_add(a, s, out)
+    assert np.all(out == a + 2)
+    e = np.zeros((0, 4), dtype=np.float32)
+    assert t.nditer_add(e, b, e) == 0
+
+    with pytest.raises(ValueError) as excinfo:
+        t.nditer_add(a, np.zeros(3, dtype=np.float32), out)
+    assert 'could not be broadcast' in str(excinfo.value)
+
+    with pytest.raises(ValueError) as excinfo:
+        t.nditer_cuda()
+    assert 'must reside in CPU memory' in str(excinfo.value)
+
+@needs_numpy
+def test36_alloc():
+    a = t.ret_empty(10)
+    assert a.shape == (10, 3) and a.dtype == np.float32
+    assert a.flags.c_contiguous and a.flags.writeable
+    assert a.__array_interface__["data"][0] % 64 == 0
+    a[:] = 1
+    assert np.all(a == 1)
+
+    b = t.ret_zeros(100)
+    assert b.shape == (100, 3) and b.dtype == np.float64
+    assert b.__array_interface__["data"][0] % 64 == 0
+    assert np.all(b == 0)
+
+    # Storage is recycled through the pool and re-zeroed
+    b[:] = 5
+    ptr = b.__array_interface__["data"][0]
+    del b
+    b = t.ret_zeros(100)
+    assert b.__array_interface__["data"][0] == ptr
+    assert np.all(b == 0)
+
+    c = t.ret_zeros_f(4)
+    assert c.flags.f_contiguous and not c.flags.c_contiguous
+    assert np.all(c == np.arange(4)[:, None] * 10 + np.arange(3)[None, :])
+
+    d = t.ret_empty(1 << 20, huge_pages=True)
+    assert d.shape == (1 << 20, 3)
+    d[:] = 2
+    assert np.all(d == 2)
+
+    e = t.ret_zeros(0)
+    assert e.shape == (0, 3)
+
+    # The shape must match the annotations of the array type
+    assert t.ret_zeros_shape(2, 3).shape == (2, 3)
+    with pytest.raises(ValueError) as excinfo:
+        t.ret_zeros_mismatch(4)
+    assert 'incompatible' in str(excinfo.value)
+    with pytest.raises(ValueError) as excinfo:
+        t.ret_zeros_shape(4, 2)
+    assert 'incompatible' in str(excinfo.value)
+
+    # The size computation must not wrap around
+    with pytest.raises(ValueError) as excinfo:
+        t.ret_zeros(2**62)
+    assert 'overflows' in str(excinfo.value)
+
+@needs_numpy
+def test37_map_file(tmp_path):
+    fname = str(tmp_path / 'data.bin')
+    data = np.arange(64, dtype=np.float32)
+    data.tofile(fname)
+
+    a = t.map_file_ro(fname, 4, 0)
+    assert a.shape == (4, 2) and not a.flags.writeable
+    assert np.all(a == data[:8].reshape(4, 2))
+
+    # Offsets don't need to be page-aligned
+    b = t.map_file_ro(fname, 3, 40)
+    assert np.all(b == data[10:16].reshape(3, 2))
+
+    # Copy-on-write mapping of the whole file
+    c = t.map_file_cow(fname)
+    assert c.shape == (64,) and c.flags.writeable
+    assert c[0] == -1 and np.all(c[1:] == data[1:])
+    c[1] = 123
+    assert np.all(np.fromfile(fname, dtype=np.float32) == data)
+    del a, b, c
+
+    with pytest.raises(ValueError) as excinfo:
+        t.map_file_ro(fname, 33, 0)
+    assert 'too small' in str(excinfo.value)
+
+    # The size computation must not wrap around
+    with pytest.raises(ValueError) as excinfo:
+        t.map_file_ro(fname, 2**62, 0)
+    assert 'too small' in str(excinfo.value)
+
+    # The shape must be compatible with the ndim<..>/shape<..> annotation
+    with pytest.raises(ValueError) as excinfo:
+        t.map_file_mismatch(fname, 4)
+    assert 'incompatible' in str(excinfo.value)
+    with pytest.raises(ValueError) as excinfo:
+        t.map_file_shape(fname)
+    assert 'incompatible' in str(excinfo.value)
+
+    with pytest.raises(OSError):
+        t.map_file_ro(str(tmp_path / 'missing.bin'), 1, 0)
+
+    empty = str(tmp_path / 'empty.bin')
+    open(empty, 'wb').close()
+    assert t.map_file_cow(empty).shape == (0,)
+
+@needs_numpy
+def test38_half_bfloat16_complex():
+    assert t.half_sum.__doc__ == "half_sum(x: ndarray[dtype=float16, writable=False, shape=(*), device='cpu']) -> float"
+    x = np.array([1, 2.5, -0.5], dtype=np.float16)
+    assert t.half_sum(x) == 3
+    assert t.half_sum(x.astype(np.float32)) == 3
+
+    h = t.ret_half(5)
+    assert h.dtype == np.float16
+    assert np.all(h == [0, 0.5, 1, 1.5, 2])
+
+    assert t.complex_sum(np.array([1+2j, 3-1j], dtype=np.complex128)) == 4+1j
+
+    v = t.ret_float4()
+    assert v.shape == (2, 4) and v.dtype == np.float32
+    assert np.all(v == np.arange(1, 9).reshape(2, 4))
+
+    assert 'dtype=bfloat16' in t.bfloat16_scale.__doc__
+    ml_dtypes = pytest.importorskip('ml_dtypes')
+    b = np.array([1, 2, 3.5], dtype=ml_dtypes.bfloat16)
+    r = t.bfloat16_scale(b, 2)
+    assert r.dtype == ml_dtypes.bfloat16
+    assert np.all(r.astype(np.float32) == [2, 4, 7])
+    r = t.bfloat16_scale(np.array([1, 2], dtype=np.float32), 0.5)
+    assert np.all(r.astype(np.float32) == [0.5, 1])
+
+@needs_numpy
+def test39_views():
+    a = np.arange(20, dtype=np.float32).reshape(5, 4)
+    b = t.view_batches(a, 2)
+    assert [x.shape for x in b] == [(2, 4), (2, 4), (1, 4)]
+    assert all(np.shares_memory(x, a) for x in b)
+    assert np.all(b[1] == a[2:4]) and np.all(b[2] == a[4:])
+    b[0][1, 1] = -1
+    assert a[1, 1] == -1
+
+    assert np.all(t.view_slice(a, 1, 3, 0, -2) == a[:, 3:0:-2])
+    assert np.all(t.view_slice(a, 0, -2, 100, 1) == a[-2:100])
+    assert t.view_slice(a, 0, 3, 1, 1).shape == (0, 4)
+    assert np.all(t.view_select(a, 1, -1) == a[:, -1])
+    assert np.all(t.view_select(a, 0, 2) == a[2])
+    assert np.all(t.view_transpose(a) == a.T)
+    assert np.all(t.view_reshape(a, 20) == a.ravel())
+    assert np.all(t.view_reshape(a.T, 20) == a.T.ravel('F'))
+    assert np.shares_memory(t.view_reshape(a, 20), a)
+
+    with pytest.raises(ValueError):
+        t.view_slice(a, 0, 0, 1, 0)
+    with pytest.raises(IndexError):
+        t.view_slice(a, 2, 0, 1, 1)
+    with pytest.raises(IndexError):
+        t.view_select(a, 0, 5)
+    with pytest.raises(ValueError) as excinfo:
+        t.view_reshape(a[:, ::2], 10)
+    assert 'contiguous' in str(excinfo.value)
+    with pytest.raises(ValueError):
+        t.view_reshape(a, 19)
+
+    # The view keeps the pooled storage of its (expired) parent alive
+    z = t.view_of_zeros()
+    assert np.all(z == [0, 5])
+
+@needs_numpy
+def test40_ret_array():
+    assert t.ret_array_vec.__doc__ == 'ret_array_vec(arg: int, /) -> numpy.ndarray[dtype=float64, shape=(*)]'
+    a = t.ret_array_vec(5)
+    assert a.dtype == np.float64 and np.all(a == [0, 0.5, 1, 1.5, 2])
+    assert a.flags.writeable and a.flags.c_contiguous
+    assert t.ret_array_vec(0).shape == (0,)
+
+    b = t.ret_array_std_array()
+    assert b.dtype == np.int16 and np.all(b == [1, -2, 3])
+
+    c = t.ret_array_vec3(4)
+    assert c.shape == (4, 3) and c.dtype == np.float32
+    assert np.all(c[:, 0] == np.arange(4)) and np.all(c[:, 2] == -np.arange(4))
+    assert t.ret_array_vec3(0).shape == (0, 3)
+
+    d = t.ret_array_nested(3, 2, False)
+    assert d.shape == (3, 2) and d.dtype == np.int32
+    assert np.all(d == np.arange(6).reshape(3, 2))
+    assert t.ret_array_nested(0, 2, False).shape == (0, 0)
+    with pytest.raises(ValueError) as excinfo:
+        t.ret_array_nested(3, 2, True)
+    assert 'rectangular' in str(excinfo.value)
+
+    e = t.ret_array_ref()
+    assert e.dtype == np.uint8 and np.all(e == [1, 2, 3])
+    e[0] = 5
+    assert np.all(t.ret_array_ref() == [1, 2, 3])
@@ -8,11 +8,20 @@
 #include <nanobind/stl/optional.h>
 #include <nanobind/stl/variant.h>
 #include <nanobind/stl/map.h>
+#include <nanobind/stl/unordered_map.h>
 #include <nanobind/stl/array.h>
 #include <nanobind/stl/unordered_set.h>
 #include <nanobind/stl/set.h>
 #include <nanobind/stl/filesystem.h>
 #include <nanobind/stl/complex.h>
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+#if defined(__cpp_lib_span)
+#  include <nanobind/stl/span.h>
+#endif
 
 NB_MAKE_OPAQUE(std::vector<float, std::allocator<float>>)
 
@@ -229,6 +238,26 @@ NB_MODULE(test_stl_ext, m) {
         return f;
     });
 
+    m.def("call_function_released", [](std::function<int(int)> &f, int x) {
+        nb::gil_scoped_release g;
+        return f(x);
+    });
+    m.def("gil_state", [](int x) { return x + (PyGILState_Check() ? 100 : 0); },
+          nb::direct());
+    m.def("gil_state_2", [](int x) { return x + (PyGILState_Check() ? 100 : 0); });
+    m.def("gil_state_long", [](long x) { return (int) x + (PyGILState_Check() ? 100 : 0); },
+          nb::direct());
+
+    m.def("call_batched", [](std::function<void(int)> f, int n, size_t batch_size,
+                             bool flush) {
+        nb::gil_scoped_release g;
+        nb::batched_function<void(int)> b(f, batch_size);
+        for (int i = 0; i < n; ++i)
+            b(i);
+        if (flush)
+            b.flush();
+    });
+
     m.def("identity_list", [](std::list<int> &x) { return x; });
 
     PyType_Slot slots[] = {
@@ -263,6 +292,19 @@ NB_MODULE(test_stl_ext, m) {
     m.def("variant_ret_var_none", []() { return std::variant<std::monostate, Copyable, int>(); });
     m.def("variant_unbound_type", [](std::variant<std::monostate, nb::list, nb::tuple, int> &x) { return x; },
           nb::arg("x") = nb::none());
+    m.def("variant_index", [](const std::variant<int, std::string, double, nb::list, Copyable> &x) {
+        return x.index();
+    });
+    using BoundVariant = std::variant<Movable *, StructWithReadonlyMap *, Copyable *>;
+    m.def("variant_index_bound", [](BoundVariant x) { return x.index(); });
+    m.def("variant_cached_index", [](nb::handle h) {
+        // Functions with a single overload only run the implicit conversion pass
+        return nb::detail::make_caster<BoundVariant>::cached_index(
+            Py_TYPE(h.ptr()), true);
+    });
+    m.def("variant_index_int", [](const std::variant<int8_t, int64_t, std::string> &x) {
+        return x.index();
+    });
 
     // ----- test50-test57 ------
     m.def("map_return_movable_value", [](){
@@ -445,4 +487,52 @@ NB_MODULE(test_stl_ext, m) {
     m.def("vector_str", [](std::string& x){
         return x;
     });
+
+    m.def("vector_double", [](const std::vector<double> &x) { return x; });
+    m.def("vector_int32", [](const std::vector<int32_t> &x) { return x; });
+    m.def("vector_uint8", [](const std::vector<uint8_t> &x) { return x; });
+    m.def("vector_int64_noconvert", [](const std::vector<int64_t> &x) { return x; },
+          nb::arg("x").noconvert());
+
+    m.def("unordered_map_str_int",
+          [](const std::unordered_map<std::string, int> &x) { return x; });
+
+    m.def("string_repeat", [](const std::string &x, size_t n) {
+        std::string result;
+        for (size_t i = 0; i < n; ++i)
+            result += x;
+        return result;
+    });
+    m.def("string_view_identity", [](std::string_view x) { return x; });
+    m.def("set_string_interning", &nb::set_string_interning,
+          nb::arg("max_length"), nb::arg("capacity") = 4096);
+
+    m.def("string_view_size", [](std::string_view x) { return x.size(); });
+    m.def("string_view_sum", [](std::string_view x) {
+        size_t sum = 0;
+        for (char c : x)
+            sum += (uint8_t) c;
+        return sum;
+    });
+    m.def("string_view_or_bytes", [](std::string_view) { return 0; });
+    m.def("string_view_or_bytes", [](nb::bytes) { return 1; });
+
+#if defined(__cpp_lib_span)
+    m.def("span_bytes_sum", [](std::span<const std::byte> x) {
+        size_t sum = 0;
+        for (std::byte b : x)
+            sum += (size_t) b;
+        return sum;
+    });
+    m.def("span_double_sum", [](std::span<const double> x) {
+        double sum = 0;
+        for (double d : x)
+            sum += d;
+        return sum;
+    });
+    m.def("span_uint8_fill", [](std::span<uint8_t> x, uint8_t value) {
+        for (uint8_t &v : x)
+            v = value;
+    });
+#endif
 }
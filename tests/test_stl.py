@@ -830,3 +830,251 @@ def test71_null_input():
         t.vec_movable_in_value([None])
     with pytest.raises(TypeError):
         t.map_copyable_in_value({'a': None})
+
+def test72_vector_arith():
+    assert t.vector_double([1.5, 2, -3.25]) == [1.5, 2.0, -3.25]
+    assert t.vector_double((1.0,)) == [1.0]
+    assert t.vector_double([]) == []
+    assert t.vector_int32([1, -2, 3]) == [1, -2, 3]
+    assert t.vector_uint8(range(3)) == [0, 1, 2]
+    with pytest.raises(TypeError):
+        t.vector_int32([1, 2**31])
+    with pytest.raises(TypeError):
+        t.vector_uint8([-1])
+    with pytest.raises(TypeError):
+        t.vector_int32([1, 2.5])
+    with pytest.raises(TypeError):
+        t.vector_uint8(b'123')
+
+    import array
+    assert t.vector_double(array.array('d', [1, 2, 3])) == [1, 2, 3]
+    assert t.vector_double(array.array('i', [1, 2, 3])) == [1, 2, 3]
+    assert t.vector_double(memoryview(array.array('f', [0.5, 1]))) == [0.5, 1]
+    assert t.vector_int32(array.array('q', [4, -5])) == [4, -5]
+    assert t.vector_int32(array.array('h', [4, -5])[::-1]) == [-5, 4]
+    with pytest.raises(TypeError):
+        t.vector_int32(array.array('q', [2**40]))
+    with pytest.raises(TypeError):
+        t.vector_uint8(array.array('b', [-1]))
+    with pytest.raises(TypeError):
+        t.vector_int32(array.array('d', [1.5]))
+    assert t.vector_int64_noconvert([1, 2]) == [1, 2]
+
+    try:
+        import numpy as np
+    except ImportError:
+        return
+
+    x = np.arange(10, dtype=np.float64)
+    assert t.vector_double(x) == list(x)
+    assert t.vector_double(x[::3]) == [0, 3, 6, 9]
+    assert t.vector_double(x.astype(np.float32)) == list(x)
+    assert t.vector_double(x.astype(np.uint16)) == list(x)
+    assert t.vector_int32(x.astype(np.int64)) == list(range(10))
+    assert t.vector_uint8(x.astype(np.int8)) == list(range(10))
+    with pytest.raises(TypeError):
+        t.vector_double(x.reshape(2, 5))
+    with pytest.raises(TypeError):
+        t.vector_uint8(np.array([300], dtype=np.int32))
+
+    # NumPy arrays require implicit conversion, like their elements do
+    with pytest.raises(TypeError):
+        t.vector_int64_noconvert(np.array([1, 2], dtype=np.int64))
+
+
+def test73_dict_roundtrip():
+    d = { str(i) : i for i in range(1000) }
+    assert t.unordered_map_str_int(d) == d
+    assert t.unordered_map_str_int({}) == {}
+
+    # Non-dict mappings are converted via their items
+    import collections
+    od = collections.OrderedDict([("a", 1), ("b", 2)])
+    assert t.unordered_map_str_int(od) == {"a": 1, "b": 2}
+
+    with pytest.raises(TypeError):
+        t.unordered_map_str_int({"a": "b"})
+
+
+def test74_string_interning():
+    try:
+        # Results are distinct objects by default
+        assert t.string_repeat("ab", 2) is not t.string_repeat("ab", 2)
+
+        t.set_string_interning(8, 16)
+        a = t.string_repeat("ab", 2)
+        assert a == "abab" and t.string_repeat("ab", 2) is a
+        assert t.string_view_identity("abab") is a
+        assert t.string_repeat("ä", 3) is t.string_repeat("ä", 3)
+
+        # Longer strings bypass the cache
+        b = t.string_repeat("ab", 5)
+        assert b == "ababababab"
+        assert t.string_repeat("ab", 5) is not b
+
+        # Colliding entries replace each other in the bounded table
+        values = [t.string_repeat(str(i), 1) for i in range(100)]
+        assert values == [str(i) for i in range(100)]
+    finally:
+        t.set_string_interning(0)
+
+    assert t.string_repeat("ab", 2) is not t.string_repeat("ab", 2)
+
+
+def test75_string_view_buffer():
+    assert t.string_view_size(b"") == 0
+    assert t.string_view_sum(b"\x01\x02\xff") == 258
+    assert t.string_view_sum(bytearray(b"\x01\x02")) == 3
+    assert t.string_view_sum(memoryview(b"\x01\x02\x03")[1:]) == 5
+    assert t.identity_string_view(b"orange") == "orange"
+
+    import array
+    assert t.string_view_size(array.array("i", [1, 2, 3])) == 12
+
+    # Non-contiguous buffers are rejected
+    with pytest.raises(TypeError):
+        t.string_view_size(memoryview(b"abcd")[::2])
+
+    with pytest.raises(TypeError):
+        t.string_view_size(1)
+
+    # Buffers are only accepted during the implicit conversion pass
+    assert t.string_view_or_bytes("a") == 0
+    assert t.string_view_or_bytes(b"a") == 1
+    assert t.string_view_or_bytes(bytearray(b"a")) == 0
+    assert t.string_view_size.__doc__ == (
+        "string_view_size(arg: Union[str, bytes], /) -> int")
+
+    # Return values are always strings
+    assert t.identity_string_view.__doc__ == (
+        "identity_string_view(arg: Union[str, bytes], /) -> str")
+
+
+@pytest.mark.skipif(not hasattr(t, "span_bytes_sum"),
+                    reason="std::span is not available")
+def test76_span():
+    import array
+    assert t.span_bytes_sum(b"\x01\x02\x03") == 6
+    assert t.span_bytes_sum(bytearray(b"\x04")) == 4
+    assert t.span_double_sum(array.array("d", [1.0, 2.5])) == 3.5
+
+    # Element type must match the buffer format
+    with pytest.raises(TypeError):
+        t.span_double_sum(array.array("f", [1.0, 2.5]))
+
+    b = bytearray(4)
+    t.span_uint8_fill(b, 7)
+    assert b == b"\x07" * 4
+
+    # Spans of non-const entries require a writable buffer
+    with pytest.raises(TypeError):
+        t.span_uint8_fill(b"1234", 7)
+
+    assert t.span_bytes_sum.__doc__ == "span_bytes_sum(arg: bytes, /) -> int"
+    assert t.span_double_sum.__doc__ == (
+        "span_double_sum(arg: collections.abc.Buffer, /) -> float")
+    assert t.span_uint8_fill.__doc__ == (
+        "span_uint8_fill(arg0: bytearray, arg1: int, /) -> None")
+
+
+def test77_function_direct_call():
+    # Bound C++ functions with a matching signature are called directly
+    # (i.e., without reacquiring the GIL)
+    assert t.call_function_released(t.gil_state, 1) == 1
+    assert t.call_function(t.gil_state, 1) == 101
+    assert t.return_function()(1) == 6
+
+    # Functions without nb::direct(), signature mismatches and Python
+    # callables go through the Python calling convention
+    assert t.call_function_released(t.gil_state_2, 1) == 101
+    assert t.call_function_released(t.gil_state_long, 1) == 101
+    assert t.call_function_released(lambda x: x + 1, 1) == 2
+
+
+def test78_function_callback():
+    l = []
+    t.call_batched(l.append, 10, 3, False)
+    assert l == list(range(10))
+
+    l = []
+    t.call_batched(l.append, 10, 3, True)
+    assert l == list(range(10))
+
+    def f(x):
+        if x == 4:
+            raise RuntimeError("oops")
+
+    with pytest.raises(RuntimeError, match="oops"):
+        t.call_batched(f, 10, 5, True)
+
+    # Calls following a failed one are delivered later on
+    l = []
+
+    def g(x):
+        if x == 2:
+            raise RuntimeError("oops")
+        l.append(x)
+
+    with pytest.raises(RuntimeError, match="oops"):
+        t.call_batched(g, 10, 5, True)
+    assert l == [0, 1, 3, 4]
+
+    # Errors during delivery in the destructor are reported as unraisable
+    import sys
+    errors = []
+    hook = sys.unraisablehook
+    sys.unraisablehook = lambda e: errors.append(str(e.exc_value))
+    try:
+        t.call_batched(f, 5, 10, False)
+    finally:
+        sys.unraisablehook = hook
+    assert errors == ["oops"]
+
+
+def test79_std_variant_first_match():
+    # Alternatives are tried in order, regardless of earlier calls
+    values = [5, "a", 5.5, [1], t.Copyable()]
+    for i in range(3):
+        assert [t.variant_index(v) for v in values] == [0, 1, 2, 3, 4]
+        values.reverse()
+        assert [t.variant_index(v) for v in values] == [4, 3, 2, 1, 0]
+        values.reverse()
+
+    with pytest.raises(TypeError):
+        t.variant_index(())
+    assert t.variant_index(1.5) == 2
+
+    # Whether an alternative accepts a value can depend on the value
+    assert t.variant_index_int(5) == 0
+    assert t.variant_index_int(1000) == 1
+    assert t.variant_index_int(5) == 0
+    assert t.variant_index_int("a") == 2
+
+
+def test80_std_variant_cache():
+    # The alternative that accepted a bound type is memoized
+    c = t.Copyable()
+    assert t.variant_cached_index(c) == -1
+    assert t.variant_index_bound(c) == 2
+    assert t.variant_cached_index(c) == 2
+    assert t.variant_index_bound(t.Movable()) == 0
+    assert t.variant_index_bound(c) == 2
+
+    # .. including Python subclasses, until a type is destroyed
+    class Sub(t.Copyable):
+        pass
+
+    s = Sub()
+    assert t.variant_index_bound(s) == 2
+    assert t.variant_cached_index(s) == 2
+
+    class Other(t.Movable):
+        pass
+
+    del Other
+    collect()
+    assert t.variant_cached_index(s) == -1
+    assert t.variant_index_bound(s) == 2
+
+    with pytest.raises(TypeError):
+        t.variant_index_bound(5)
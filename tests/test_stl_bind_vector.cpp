@@ -7,6 +7,18 @@ namespace nb = nanobind;
 NB_MODULE(test_bind_vector_ext, m) {
     nb::bind_vector<std::vector<unsigned int>>(m, "VectorInt");
     nb::bind_vector<std::vector<bool>>(m, "VectorBool");
+    nb::bind_vector<std::vector<double>>(m, "VectorDouble");
+
+    // A user-provided 'type_slots' annotation is combined with the buffer slots
+    static PyType_Slot vector_int16_slots[] = {
+        { Py_nb_negative, (void *) +[](PyObject *o) -> PyObject * {
+              return PyLong_FromSize_t(
+                  nb::inst_ptr<std::vector<int16_t>>(o)->size());
+          } },
+        { 0, nullptr }
+    };
+    nb::bind_vector<std::vector<int16_t>>(m, "VectorInt16",
+                                          nb::type_slots(vector_int16_slots));
 
     // Ensure that a repeated binding call is ignored
     nb::bind_vector<std::vector<bool>>(m, "VectorBool");
@@ -1,5 +1,4 @@
 import pytest
-import platform
 
 import test_bind_vector_ext as t
 
@@ -44,14 +43,9 @@ def test01_vector_int(capfd):
     with pytest.raises(TypeError):
         v_int2.extend([8, "a"])
 
+    # extend() converts sequences directly without an implicit conversion
     captured = capfd.readouterr().err.strip()
-    ref = "nanobind: implicit conversion from type 'list' to type 'test_bind_vector_ext.VectorInt' failed!"
-
-    # Work around Pytest-related flakiness (https://github.com/pytest-dev/pytest/issues/10843)
-    if platform.system() == 'Windows':
-        assert captured == ref or captured == ''
-    else:
-        assert captured == ref
+    assert captured == ''
 
     assert v_int2 == t.VectorInt([0, 99, 2, 3, 4, 5, 6, 7])
 
@@ -145,3 +139,112 @@ def test05_vector_slicing():
     check_del(slice(200, 10, 1))
     check_del(slice(200, 10, -1))
     check_del(slice(200, 10, -3))
+
+def test06_vector_buffer():
+    v = t.VectorInt([1, 2, 3])
+    m = memoryview(v)
+    assert m.format == 'I' and m.shape == (3,) and not m.readonly
+    assert m.tolist() == [1, 2, 3]
+    m[1] = 5
+    assert v[1] == 5
+
+    # The vector cannot be re-sized while its storage is exported
+    for op in (lambda: v.append(1), lambda: v.pop(), v.clear,
+               lambda: v.extend(t.VectorInt([1])), lambda: v.insert(0, 1)):
+        with pytest.raises(BufferError):
+            op()
+    def delitem():
+        del v[0]
+    with pytest.raises(BufferError):
+        delitem()
+    v[0] = 4
+    assert v == t.VectorInt([4, 5, 3])
+    m.release()
+    v.append(6)
+    assert list(v) == [4, 5, 3, 6]
+
+    # Exports are counted per instance
+    m1, m2 = memoryview(v), memoryview(v)
+    v2 = t.VectorInt([1])
+    v2.append(2)
+    m1.release()
+    with pytest.raises(BufferError):
+        v.append(7)
+    m2.release()
+    v.append(7)
+    assert len(v) == 5
+
+    assert memoryview(t.VectorInt()).tolist() == []
+
+    # Entries without a buffer format are exported as bytes
+    e = t.VectorEl()
+    e.append(t.El(7))
+    m = memoryview(e)
+    assert m.format == 'B' and m.shape == (1, 4)
+    del m
+
+    with pytest.raises(TypeError):
+        memoryview(t.VectorBool())
+
+    f = t.VectorInt16([1, 2])
+    assert -f == 2
+    assert memoryview(f).tolist() == [1, 2]
+
+    try:
+        import numpy as np
+    except ImportError:
+        return
+
+    d = t.VectorDouble([1.5, 2.5])
+    a = np.asarray(d)
+    assert a.dtype == np.float64 and np.all(a == [1.5, 2.5])
+    a[0] = 0
+    assert d[0] == 0
+    with pytest.raises(BufferError):
+        d.append(1)
+    del a
+    d.append(1)
+    assert list(d) == [0, 2.5, 1]
+
+def test07_vector_bulk():
+    import array
+    v = t.VectorInt(array.array('I', [1, 2, 3]))
+    assert list(v) == [1, 2, 3]
+    v.extend([4, 5])
+    v.extend((6,))
+    v.extend(x for x in range(7, 9))
+    v.extend(array.array('H', [9]))
+    v.extend(t.VectorInt([10]))
+    assert list(v) == list(range(1, 11))
+    assert 'extend(self, arg: Iterable[int], /) -> None' in t.VectorInt.extend.__doc__
+
+    # Failed conversions leave the vector unchanged
+    with pytest.raises(TypeError):
+        v.extend([11, -1])
+    with pytest.raises(TypeError):
+        v.extend(array.array('i', [11, -1]))
+    with pytest.raises(TypeError):
+        v.extend(x for x in [11, 'a'])
+    assert list(v) == list(range(1, 11))
+
+    assert list(v[2:5]) == [3, 4, 5]
+    del v[::3]
+    assert list(v) == [2, 3, 5, 6, 8, 9]
+    del v[-1:0:-2]
+    assert list(v) == [2, 5, 8]
+
+    e = t.VectorEl([t.El(1)])
+    e.extend([t.El(2), t.El(3)])
+    assert [x.a for x in e] == [1, 2, 3]
+    with pytest.raises(TypeError):
+        e.extend([t.El(4), None])
+    assert len(e) == 3
+
+    try:
+        import numpy as np
+    except ImportError:
+        return
+
+    d = t.VectorDouble(np.arange(5, dtype=np.float32))
+    d.extend(np.array([5, 6], dtype=np.int64))
+    assert list(d) == list(range(7))